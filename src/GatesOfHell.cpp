@@ -20,6 +20,7 @@
 
 #include "GatesOfHell.h"
 #include "device/cpu/Cpu.h"
+#include "device/cpu/PageAttributeTable.h"
 #include "kernel/log/Log.h"
 #include "kernel/memory/MemoryLayout.h"
 #include "kernel/memory/Paging.h"
@@ -33,6 +34,7 @@
 #include "kernel/service/InformationService.h"
 #include "device/system/SmBios.h"
 #include "device/time/pit/Pit.h"
+#include "device/time/apic/ApicTimer.h"
 #include "device/time/rtc/Rtc.h"
 #include "kernel/service/TimeService.h"
 #include "kernel/service/ProcessService.h"
@@ -57,6 +59,7 @@
 #include "filesystem/memory/RandomNode.h"
 #include "filesystem/memory/MountsNode.h"
 #include "kernel/memory/MemoryStatusNode.h"
+#include "kernel/process/SchedulerStatusNode.h"
 #include "device/system/FirmwareConfiguration.h"
 #include "filesystem/qemu/FirmwareConfigurationDriver.h"
 #include "filesystem/acpi/AcpiDriver.h"
@@ -79,6 +82,7 @@
 #include "BuildConfig.h"
 #include "util/async/BasicRunnable.h"
 #include "kernel/memory/PagingAreaManagerRefillRunnable.h"
+#include "kernel/memory/ZeroedFramePoolRefillRunnable.h"
 #include "lib/util/async/Process.h"
 #include "device/hid/Ps2Controller.h"
 #include "device/interrupt/pic/Pic.h"
@@ -239,10 +243,25 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
     memoryMapTarget.copyRange(Util::Address(memoryMap), memoryMap->tagHeader.size);
     memoryMap = reinterpret_cast<Kernel::Multiboot::MemoryMapHeader*>((kernelHeapVirtual + INITIAL_KERNEL_HEAP_SIZE) - memoryMap->tagHeader.size);
 
-    // Enable paging
+    // Enable paging (with write protection in kernel mode, so that writes to copy-on-write pages fault in system calls as well)
     LOG_INFO("Enabling paging");
     Kernel::Paging::loadDirectory(*pageDirectory);
-    Device::Cpu::writeCr0(Device::Cpu::readCr0() | Device::Cpu::PAGING);
+    Device::Cpu::writeCr0(Device::Cpu::readCr0() | Device::Cpu::PAGING | Device::Cpu::WRITE_PROTECT);
+
+    // Enable global pages, so that kernel mappings survive address space switches, and 4 MiB pages for large device memory mappings.
+    // Application processors copy cr4 from the bootstrap processor, so they use the same paging features.
+    if (Util::Hardware::CpuId::isAvailable()) {
+        const auto features = Util::Hardware::CpuId::getCpuInfo().features;
+        if ((features & Util::Hardware::CpuId::PGE) != 0) {
+            Device::Cpu::writeCr4(Device::Cpu::readCr4() | Device::Cpu::PAGE_GLOBAL_ENABLE);
+        }
+        if ((features & Util::Hardware::CpuId::PSE) != 0) {
+            Device::Cpu::writeCr4(Device::Cpu::readCr4() | Device::Cpu::PAGE_SIZE_EXTENSIONS);
+        }
+    }
+
+    // Program the page attribute table, so that frame buffers can be mapped as write-combining memory
+    Device::PageAttributeTable::initialize();
 
     // Initialize kernel heap
     LOG_INFO("Initializing kernel heap");
@@ -361,6 +380,11 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
         Kernel::Log::setLevel(level);
     }
 
+    // Set number of pages mapped per page fault in user space heaps
+    if (multiboot->hasKernelOption("fault_around")) {
+        memoryService->setFaultAroundPages(Util::String::parseNumber<uint32_t>(multiboot->getKernelOption("fault_around")));
+    }
+
     // Memory management has been set up now, and we continue with the remaining boot process
     LOG_INFO("Welcome to hhuOS!");
     LOG_INFO("Used kernel heap memory during early boot process: [%u KiB]", (kernelHeapManager.getTotalMemory() - kernelHeapManager.getFreeMemory()) / 1024);
@@ -371,6 +395,7 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
     auto *processService = new Kernel::ProcessService(kernelProcess);
     auto &scheduler = processService->getScheduler();
     Kernel::Service::registerService(Kernel::ProcessService::SERVICE_ID, processService);
+    scheduler.registerCurrentCpu();
 
     // Initialize frame buffer
     LOG_INFO("Initializing display");
@@ -530,20 +555,32 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
             LOG_WARN("Failed to initialize APIC -> Falling back to PIC");
         } else {
             interruptService->useApic(apic);
+            Device::ApicTimer::setTicklessMode(multiboot->getKernelOption("tickless", "true") == "true");
             apic->startCurrentTimer();
 
             if (apic->isSymmetricMultiprocessingSupported()) {
                 cpuService->startupApplicationProcessors();
             }
+
+            // Receive TLB shootdowns from the application processors (virtual CPU ids are only final after their startup)
+            memoryService->registerCurrentCpu();
         }
     } else {
         LOG_INFO("APIC not available -> Falling back to PIC");
     }
 
+    // Page frames are cleared through per-CPU windows, before they are mapped into an address space
+    memoryService->reservePageClearingWindows(cpuService->getCoreCount());
+
     // Create thread to refill block pool of paging area manager
     auto &refillThread = Kernel::Thread::createKernelThread("Paging-Area-Pool-Refiller", processService->getKernelProcess(), new Kernel::PagingAreaManagerRefillRunnable(*pagingAreaManager));
     scheduler.ready(refillThread);
 
+    // Create thread to zero free page frames in the background (uses the page clearing window of the CPU it runs on)
+    auto &zeroingThread = Kernel::Thread::createKernelThread("Page-Frame-Zeroer", processService->getKernelProcess(), new Kernel::ZeroedFramePoolRefillRunnable(Kernel::Service::getService<Kernel::MemoryService>()));
+    scheduler.setNice(zeroingThread, Kernel::Scheduler::MAX_NICE);
+    scheduler.ready(zeroingThread);
+
     // Protect kernel code
     for (uint32_t address = WRITE_PROTECTED_START; address < WRITE_PROTECTED_END; address += Util::PAGESIZE) {
         // Get indices into page table and directory
@@ -554,8 +591,18 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
         auto &pageTable = *reinterpret_cast<Kernel::Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
         auto &entry = pageTable[pageTableIndex];
         entry.set(entry.getAddress(), entry.getFlags() & (~Kernel::Paging::WRITABLE));
+
+        // Kernel pages are global and not flushed by switching the address space
+        asm volatile (
+                "invlpg (%0)"
+                :
+                : "r"(address)
+                );
     }
 
+    // Application processors may already be running and must not keep writable entries either
+    memoryService->invalidateTlbEntries(memoryService->getKernelAddressSpace(), reinterpret_cast<void*>(WRITE_PROTECTED_START), (WRITE_PROTECTED_END - WRITE_PROTECTED_START) / Util::PAGESIZE);
+
     // The base system is initialized -> We can now enable interrupts and initialize timer devices
     LOG_INFO("Enabling interrupts");
     Device::Cpu::enableInterrupts();
@@ -682,6 +729,7 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
     deviceDriver->addNode("/", new Filesystem::Memory::MountsNode());
     deviceDriver->addNode("/", new Kernel::LogNode());
     deviceDriver->addNode("/", new Kernel::MemoryStatusNode());
+    deviceDriver->addNode("/", new Kernel::SchedulerStatusNode());
 
     if (Device::FirmwareConfiguration::isAvailable()) {
         auto *fwCfg = new Device::FirmwareConfiguration();
@@ -876,7 +924,7 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
             << Util::Graphic::Ansi::RESET << Util::Io::PrintStream::lnFlush;
     }
 
-    memoryService->enableSlabAllocator();
+    memoryService->enableBuddyAllocator();
 
     LOG_INFO("Starting scheduler");
     processService->startScheduler();
@@ -908,8 +956,8 @@ uint32_t GatesOfHell::createInitialMapping(Kernel::Paging::Table &pageDirectory,
         auto &table = *reinterpret_cast<Kernel::Paging::Table*>(pageDirectory[directoryIndex].getAddress());
         auto tableIndex = Kernel::Paging::TABLE_INDEX(virtualAddress);
 
-        // Create identity mapping for current kernel frame
-        table[tableIndex].set(physicalAddress, Kernel::Paging::PRESENT | Kernel::Paging::WRITABLE);
+        // Create identity mapping for current kernel frame (kernel mappings are shared by all address spaces and thus global)
+        table[tableIndex].set(physicalAddress, Kernel::Paging::PRESENT | Kernel::Paging::WRITABLE | Kernel::Paging::GLOBAL);
     }
 
     return allocatedPageTables;
@@ -20,6 +20,7 @@
 
 #include <stdint.h>
 
+#include <interface.h>
 #include <util/base/System.h>
 #include <util/base/ArgumentParser.h>
 #include <util/collection/Array.h>
@@ -48,6 +49,34 @@ void processStream(Util::Io::InputStream &stream) {
     }
 }
 
+/// Copy the content of a regular file to standard output.
+/// The data is copied inside the kernel via `copyFileRange()`, so it does not pass through this program's memory.
+/// This must only be used if standard output is not a regular file, since the write position of `Util::System::out`
+/// is not known here (character files, such as terminals and pipes, ignore the position).
+void copyFile(const Util::Io::File &file) {
+    // Make sure that previously printed characters appear before the copied data
+    Util::System::out << Util::Io::PrintStream::flush;
+
+    const auto fileDescriptor = Util::Io::File::open(file.getCanonicalPath());
+    if (fileDescriptor < 0) {
+        Util::System::error << "cat: Failed to open '" << file.getCanonicalPath() << "'!" << Util::Io::PrintStream::lnFlush;
+        return;
+    }
+
+    const uint64_t length = file.getLength();
+    uint64_t pos = 0;
+    while (pos < length) {
+        const auto copied = copyFileRange(fileDescriptor, pos, Util::Io::STANDARD_OUTPUT, 0, length - pos);
+        if (copied == 0) {
+            break;
+        }
+
+        pos += copied;
+    }
+
+    Util::Io::File::close(fileDescriptor);
+}
+
 int main(const int argc, char *argv[]) {
     Util::ArgumentParser argumentParser;
     argumentParser.setHelpText(HELP_TEXT);
@@ -61,6 +90,7 @@ int main(const int argc, char *argv[]) {
     if (arguments.length() == 0) {
         processStream(Util::System::in);
     } else {
+        const auto outputIsRegularFile = getFileType(Util::Io::STANDARD_OUTPUT) == Util::Io::File::REGULAR;
         for (const auto &path : arguments) {
             const Util::Io::File file(path);
             if (!file.exists()) {
@@ -73,6 +103,14 @@ int main(const int argc, char *argv[]) {
                 continue;
             }
 
+            if (file.getType() == Util::Io::File::REGULAR && !outputIsRegularFile) {
+                copyFile(file);
+                continue;
+            }
+
+            // Character files (e.g. devices or pipes) have no valid length and are read until EOF instead.
+            // If standard output is redirected to a file, it must be written via `Util::System::out`,
+            // so that the output position stays consistent.
             Util::Io::FileInputStream fileStream(file);
             Util::Io::BufferedInputStream bufferedStream(fileStream);
             auto &stream = file.getType() == Util::Io::File::REGULAR ?
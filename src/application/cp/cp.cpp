@@ -20,31 +20,46 @@
 
 #include <stdint.h>
 
+#include <lib/interface.h>
 #include <lib/util/base/System.h>
 #include <lib/util/base/ArgumentParser.h>
 #include <lib/util/collection/Array.h>
 #include <lib/util/io/file/File.h>
 #include <lib/util/base/String.h>
-#include <lib/util/io/stream/FileInputStream.h>
-#include <lib/util/io/stream/FileOutputStream.h>
 #include <lib/util/io/stream/PrintStream.h>
 
 constexpr const char *HELP_TEXT =
 #include "generated/README.md"
 ;
 
-uint8_t buffer[4096];
+/// Copy the content of the source file to the target file.
+/// The data is copied inside the kernel via `copyFileRange()`, so it does not pass through this program's memory.
+void copyFile(const Util::Io::File &sourceFile, const Util::Io::File &targetFile) {
+    const auto source = Util::Io::File::open(sourceFile.getCanonicalPath());
+    const auto target = Util::Io::File::open(targetFile.getCanonicalPath());
+    if (source < 0 || target < 0) {
+        Util::System::error << "cp: Failed to open '" << (source < 0 ? sourceFile : targetFile).getCanonicalPath() << "'!" <<
+            Util::Io::PrintStream::lnFlush;
+    } else {
+        const uint64_t length = sourceFile.getLength();
+        uint64_t pos = 0;
+        while (pos < length) {
+            const auto copied = copyFileRange(source, pos, target, pos, length - pos);
+            if (copied == 0) {
+                break;
+            }
 
-/// Copy data from the source file stream to target file stream.
-/// The function reads data in chunks of 4096 bytes until a read operation returns 0 or less.
-void copyFile(Util::Io::FileInputStream &source, Util::Io::FileOutputStream &target) {
-    int32_t read;
-    do {
-        read = source.read(buffer, 0, 4096);
-        if (read > 0) {
-            target.write(buffer, 0, read);
+            pos += copied;
         }
-    } while (read > 0);
+    }
+
+    if (source >= 0) {
+        Util::Io::File::close(source);
+    }
+
+    if (target >= 0) {
+        Util::Io::File::close(target);
+    }
 }
 
 int main(const int argc, char *argv[]) {
@@ -91,9 +106,7 @@ int main(const int argc, char *argv[]) {
             return -1;
         }
 
-        Util::Io::FileInputStream source(sourceFile);
-        Util::Io::FileOutputStream target(targetFile);
-        copyFile(source, target);
+        copyFile(sourceFile, targetFile);
     } else {
         const Util::Io::File targetDirectory(arguments[arguments.length() - 1]);
         if (!targetDirectory.exists()) {
@@ -132,9 +145,7 @@ int main(const int argc, char *argv[]) {
                 continue;
             }
 
-            Util::Io::FileInputStream source(sourceFile);
-            Util::Io::FileOutputStream target(targetFile);
-            copyFile(source, target);
+            copyFile(sourceFile, targetFile);
         }
     }
 
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <stdint.h>
+
+#include <interface.h>
+#include <util/async/Runnable.h>
+#include <util/async/Thread.h>
+#include <util/base/ArgumentParser.h>
+#include <util/base/FreeListMemoryManager.h>
+#include <util/base/HeapMemoryManager.h>
+#include <util/base/String.h>
+#include <util/base/System.h>
+#include <util/collection/Array.h>
+#include <util/io/stream/PrintStream.h>
+#include <util/time/Timestamp.h>
+
+constexpr const char *HELP_TEXT =
+#include "generated/README.md"
+;
+
+/// Allocates and frees a number of objects of a given size and measures the time taken for both operations.
+/// Every second object is freed in a first pass to fragment the heap, the remaining objects are freed afterward.
+class MallocBenchmark : public Util::Async::Runnable {
+
+public:
+    MallocBenchmark(Util::HeapMemoryManager &memoryManager, const size_t objectSize, const size_t objectCount) :
+        memoryManager(memoryManager), objectSize(objectSize), objects(objectCount) {}
+
+    void run() override {
+        const auto allocationStart = Util::Time::Timestamp::getSystemTime();
+        for (auto &object : objects) {
+            object = memoryManager.allocateMemory(objectSize, 0);
+        }
+        allocationTime = Util::Time::Timestamp::getSystemTime() - allocationStart;
+
+        const auto freeStart = Util::Time::Timestamp::getSystemTime();
+        for (size_t i = 1; i < objects.length(); i += 2) {
+            memoryManager.freeMemory(objects[i], 0);
+        }
+        for (size_t i = 0; i < objects.length(); i += 2) {
+            memoryManager.freeMemory(objects[i], 0);
+        }
+        freeTime = Util::Time::Timestamp::getSystemTime() - freeStart;
+    }
+
+    const Util::Time::Timestamp& getAllocationTime() const {
+        return allocationTime;
+    }
+
+    const Util::Time::Timestamp& getFreeTime() const {
+        return freeTime;
+    }
+
+private:
+
+    Util::HeapMemoryManager &memoryManager;
+    const size_t objectSize;
+    Util::Array<void*> objects;
+
+    Util::Time::Timestamp allocationTime;
+    Util::Time::Timestamp freeTime;
+};
+
+int32_t main(const int32_t argc, char *argv[]) {
+    Util::ArgumentParser argumentParser;
+    argumentParser.setHelpText(HELP_TEXT);
+    argumentParser.addArgument("count", false, "c");
+    argumentParser.addArgument("threads", false, "t");
+    argumentParser.addSwitch("freelist", "f");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::lnFlush;
+        return -1;
+    }
+
+    const auto count = Util::String::parseNumber<size_t>(argumentParser.getArgument("count", "10000"));
+    const auto threadCount = Util::String::parseNumber<size_t>(argumentParser.getArgument("threads", "1"));
+    if (count < 2 || threadCount == 0) {
+        Util::System::error << "mallocbench: Invalid object or thread count!" << Util::Io::PrintStream::lnFlush;
+        return -1;
+    }
+
+    auto &addressSpaceHeader = Util::System::getAddressSpaceHeader();
+    Util::HeapMemoryManager &memoryManager = argumentParser.checkSwitch("freelist") ?
+        static_cast<Util::HeapMemoryManager&>(addressSpaceHeader.heapMemoryManager) :
+        static_cast<Util::HeapMemoryManager&>(addressSpaceHeader.allocationMemoryManager);
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    const uint8_t minPower = arguments.length() > 0 ? Util::String::parseNumber<uint8_t>(arguments[0]) : 4;
+    const uint8_t maxPower = arguments.length() > 1 ? Util::String::parseNumber<uint8_t>(arguments[1]) : 12;
+
+    for (uint8_t i = minPower; i <= maxPower; i++) {
+        const size_t size = 1 << i;
+        Util::Array<MallocBenchmark*> benchmarks(threadCount);
+        Util::Array<Util::Async::Thread*> threads(threadCount);
+
+        Util::System::out << "malloc " << size << " B:\t" << Util::Io::PrintStream::flush;
+
+        // The first benchmark runs on the main thread, all others get their own thread
+        for (size_t j = 0; j < threadCount; j++) {
+            benchmarks[j] = new MallocBenchmark(memoryManager, size, count);
+        }
+        for (size_t j = 1; j < threadCount; j++) {
+            threads[j] = new Util::Async::Thread(Util::Async::Thread::createThread(Util::String::format("Mallocbench-%u", j), benchmarks[j]));
+        }
+
+        benchmarks[0]->run();
+        for (size_t j = 1; j < threadCount; j++) {
+            threads[j]->join();
+            delete threads[j];
+        }
+
+        uint64_t allocationNanos = 0;
+        uint64_t freeNanos = 0;
+        for (auto *benchmark : benchmarks) {
+            allocationNanos += benchmark->getAllocationTime().toNanoseconds();
+            freeNanos += benchmark->getFreeTime().toNanoseconds();
+            delete benchmark;
+        }
+
+        const auto operations = static_cast<double>(count * threadCount);
+        Util::System::out.setDecimalPrecision(1);
+        Util::System::out << "alloc " << static_cast<double>(allocationNanos) / operations << " ns/op, free "
+            << static_cast<double>(freeNanos) / operations << " ns/op ("
+            << operations * 1000000000.0 / static_cast<double>(allocationNanos + freeNanos) / 1000000.0 << " M pairs/s)"
+            << Util::Io::PrintStream::lnFlush;
+    }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <stdint.h>
+
+#include <util/base/ArgumentParser.h>
+#include <util/base/String.h>
+#include <util/base/System.h>
+#include <util/io/stream/PrintStream.h>
+#include <util/time/Timestamp.h>
+
+constexpr const char *HELP_TEXT =
+#include "generated/README.md"
+;
+
+constexpr size_t WARMUP_ITERATIONS = 1000;
+
+/// Perform the given number of system calls and return the time taken.
+/// The mechanism is chosen by the `fastSystemCalls` flag in the address space header.
+Util::Time::Timestamp benchmarkSystemCalls(const size_t iterations) {
+    size_t threadId;
+    for (size_t i = 0; i < WARMUP_ITERATIONS; i++) {
+        Util::System::call(Util::System::GET_CURRENT_THREAD, 1, &threadId);
+    }
+
+    const auto start = Util::Time::Timestamp::getSystemTime();
+    for (size_t i = 0; i < iterations; i++) {
+        Util::System::call(Util::System::GET_CURRENT_THREAD, 1, &threadId);
+    }
+
+    return Util::Time::Timestamp::getSystemTime() - start;
+}
+
+/// Print the average time per system call and return it in nanoseconds.
+double printResult(const char *name, const Util::Time::Timestamp &time, const size_t iterations) {
+    const auto nanosPerCall = static_cast<double>(time.toNanoseconds()) / static_cast<double>(iterations);
+
+    Util::System::out.setDecimalPrecision(1);
+    Util::System::out << name << ":\t" << nanosPerCall << " ns/call (" << 1000.0 / nanosPerCall << " M calls/s)" << Util::Io::PrintStream::lnFlush;
+
+    return nanosPerCall;
+}
+
+int32_t main(const int32_t argc, char *argv[]) {
+    Util::ArgumentParser argumentParser;
+    argumentParser.setHelpText(HELP_TEXT);
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::lnFlush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    const auto iterations = arguments.length() > 0 ? Util::String::parseNumber<size_t>(arguments[0]) : 100000;
+    if (iterations == 0) {
+        Util::System::error << "syscallbench: Invalid number of iterations!" << Util::Io::PrintStream::lnFlush;
+        return -1;
+    }
+
+    // The kernel only sets this flag, if the CPU supports SYSENTER
+    auto &addressSpaceHeader = Util::System::getAddressSpaceHeader();
+    const auto fastSystemCallsAvailable = addressSpaceHeader.fastSystemCalls;
+
+    addressSpaceHeader.fastSystemCalls = false;
+    const auto interruptNanos = printResult("int 0x86", benchmarkSystemCalls(iterations), iterations);
+
+    if (!fastSystemCallsAvailable) {
+        Util::System::out << "sysenter:\tNot supported by this CPU" << Util::Io::PrintStream::lnFlush;
+        return 0;
+    }
+
+    addressSpaceHeader.fastSystemCalls = true;
+    const auto sysenterNanos = printResult("sysenter", benchmarkSystemCalls(iterations), iterations);
+
+    Util::System::out.setDecimalPrecision(2);
+    Util::System::out << "Speedup:\t" << interruptNanos / sysenterNanos << "x" << Util::Io::PrintStream::lnFlush;
+
+    return 0;
+}
@@ -52,6 +52,41 @@ void Cpu::disableInterrupts() {
     asm volatile ( "cli" );
 }
 
+uint32_t Cpu::saveAndDisableInterrupts() {
+    uint32_t flags;
+    asm volatile (
+            "pushf;"
+            "pop %0;"
+            "cli;"
+            : "=r"(flags)
+            : :
+            "memory"
+            );
+
+    return flags;
+}
+
+void Cpu::restoreInterrupts(uint32_t flags) {
+    asm volatile (
+            "push %0;"
+            "popf;"
+            : :
+            "r"(flags)
+            : "memory", "cc"
+            );
+}
+
+bool Cpu::areInterruptsEnabled() {
+    uint32_t flags;
+    asm volatile (
+            "pushf;"
+            "pop %0;"
+            : "=r"(flags)
+            );
+
+    return (flags & INTERRUPT_FLAG) != 0;
+}
+
 void Cpu::halt() {
     asm volatile (
             "cli;"
@@ -61,6 +96,33 @@ void Cpu::halt() {
     __builtin_unreachable();
 }
 
+void Cpu::enableInterruptsAndHalt() {
+    asm volatile (
+            "sti;"
+            "hlt;"
+            ::: "memory"
+            );
+}
+
+void Cpu::monitor(const volatile void *address) {
+    asm volatile (
+            "monitor;"
+            :
+            : "a"(address), "c"(0), "d"(0)
+            : "memory"
+            );
+}
+
+void Cpu::enableInterruptsAndWait() {
+    asm volatile (
+            "sti;"
+            "mwait;"
+            :
+            : "a"(0), "c"(0)
+            : "memory"
+            );
+}
+
 void Cpu::writeSegmentRegister(SegmentRegister reg, const SegmentSelector &selector) {
     switch (reg) {
         case CS:
@@ -230,6 +292,27 @@ void Cpu::writeCr4(uint32_t value) {
             :
             );
 }
+uint64_t Cpu::readXcr0() {
+    uint32_t low, high;
+    asm volatile (
+            "xgetbv"
+            : "=a"(low), "=d"(high)
+            : "c"(0)
+            :
+            );
+
+    return static_cast<uint64_t>(high) << 32 | low;
+}
+
+void Cpu::writeXcr0(uint64_t value) {
+    asm volatile (
+            "xsetbv"
+            : :
+            "a"(static_cast<uint32_t>(value)), "d"(static_cast<uint32_t>(value >> 32)), "c"(0)
+            :
+            );
+}
+
 void Cpu::loadTaskStateSegment(const Cpu::SegmentSelector &selector) {
     asm volatile (
             "ltr %0"
@@ -65,6 +65,7 @@ public:
         OS_XMM_EXCEPTIONS = 0x00000400,
         USER_MODE_INSTRUCTION_PREVENTION = 0x00001000,
         FIVE_LEVEL_PAGING_ENABLE = 0x00002000,
+        OS_XSAVE = 0x00040000,
     };
 
     enum PrivilegeLevel : uint8_t  {
@@ -126,6 +127,27 @@ public:
      */
     static void disableInterrupts();
 
+    /**
+     * Disable hardware interrupts on the calling CPU only, without modifying the global cli counter.
+     * This is used to keep the calling thread from being preempted and migrated to another CPU for a short time.
+     *
+     * @return The previous value of the EFLAGS register, which must be passed to restoreInterrupts()
+     */
+    static uint32_t saveAndDisableInterrupts();
+
+    /**
+     * Restore the interrupt flag of the calling CPU, as saved by saveAndDisableInterrupts().
+     *
+     * @param flags The value returned by saveAndDisableInterrupts()
+     */
+    static void restoreInterrupts(uint32_t flags);
+
+    /**
+     * Check if hardware interrupts are enabled on the calling CPU.
+     * Interrupt handlers always run with interrupts disabled.
+     */
+    static bool areInterruptsEnabled();
+
     static uint32_t readCr0();
 
     static void writeCr0(uint32_t value);
@@ -140,6 +162,18 @@ public:
 
     static void writeCr4(uint32_t value);
 
+    /**
+     * Read the extended control register XCR0, which contains the state components managed by XSAVE.
+     * Requires OS_XSAVE to be set in CR4.
+     */
+    static uint64_t readXcr0();
+
+    /**
+     * Write the extended control register XCR0 of the calling CPU.
+     * Requires OS_XSAVE to be set in CR4.
+     */
+    static void writeXcr0(uint64_t value);
+
     static void loadTaskStateSegment(const SegmentSelector &selector);
 
     /**
@@ -147,6 +181,25 @@ public:
      */
     [[noreturn]] static void halt();
 
+    /**
+     * Enable interrupts and halt the calling CPU until the next interrupt occurs.
+     * Since sti takes effect after the following instruction, an interrupt arriving in between still ends the halt.
+     * Must be called with interrupts disabled (e.g. via saveAndDisableInterrupts()).
+     */
+    static void enableInterruptsAndHalt();
+
+    /**
+     * Arm the address monitoring hardware for the cache line containing the given address (monitor instruction).
+     * Only available, if CPUID reports support for MONITOR/MWAIT.
+     */
+    static void monitor(const volatile void *address);
+
+    /**
+     * Enable interrupts and wait until the monitored cache line is written or an interrupt occurs (mwait instruction).
+     * Must be called with interrupts disabled after arming the monitor via monitor().
+     */
+    static void enableInterruptsAndWait();
+
     /**
      * Enumeration of all hardware exceptions
      */
@@ -189,6 +242,8 @@ public:
 
     static SegmentSelector readSegmentRegister(SegmentRegister reg);
 
+    static const constexpr uint32_t INTERRUPT_FLAG = 0x00000200; // IF bit in the EFLAGS register
+
 private:
     /**
      * Keeps track of how often disableInterrupts() and enableInterrupts() have been called.
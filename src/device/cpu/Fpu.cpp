@@ -31,14 +31,13 @@
 
 namespace Device {
 
-Fpu::Fpu(uint8_t *defaultFpuContext) {
+Fpu::Fpu() {
     disarmFpuMonitor();
 
     // Make sure FPU emulation is disabled
     Device::Cpu::writeCr0(Device::Cpu::readCr0() & ~Device::Cpu::X87_FPU_EMULATION);
 
     if (isFxsrAvailable()) {
-        LOG_INFO("FXSR support detected -> Using FXSAVE/FXRSTR for FPU context switching");
         fxsrAvailable = true;
 
         auto cpuInfo = Util::Hardware::CpuId::getCpuInfo();
@@ -51,21 +50,49 @@ Fpu::Fpu(uint8_t *defaultFpuContext) {
             Device::Cpu::writeCr4(Device::Cpu::readCr4() | Device::Cpu::OS_FXSR | Device::Cpu::OS_XMM_EXCEPTIONS);
         }
 
-        asm volatile (
-                "fninit;"
-                "fxsave %0;"
-                : "=m"(*defaultFpuContext)
-                );
+        if (isXsaveAvailable()) {
+            // CR4 is copied to the application processors on startup, but XCR0 must be set on each CPU (see enableExtendedStates())
+            Device::Cpu::writeCr4(Device::Cpu::readCr4() | Device::Cpu::OS_XSAVE);
+            xsaveAvailable = true;
+
+            // AVX-512 state is only enabled as a whole, since its components cannot be used independently
+            auto xsaveInfo = Util::Hardware::CpuId::getXsaveInfo();
+            xsaveComponents = xsaveInfo.supportedComponents & (Util::Hardware::CpuId::X87_STATE | Util::Hardware::CpuId::SSE_STATE | Util::Hardware::CpuId::AVX_STATE);
+            if ((xsaveComponents & Util::Hardware::CpuId::AVX_STATE) && (xsaveInfo.supportedComponents & AVX512_COMPONENTS) == AVX512_COMPONENTS) {
+                xsaveComponents |= AVX512_COMPONENTS;
+            }
+
+            enableExtendedStates();
+
+            // The context size reported by CPUID depends on the components enabled in XCR0
+            contextSize = Util::Hardware::CpuId::getXsaveInfo().enabledContextSize;
+            xsaveoptAvailable = xsaveInfo.xsaveopt;
+
+            LOG_INFO("XSAVE support detected -> Using %s/XRSTOR for FPU context switching (Components: [0x%08x], Context size: [%u Bytes])",
+                     xsaveoptAvailable ? "XSAVEOPT" : "XSAVE", static_cast<uint32_t>(xsaveComponents), contextSize);
+        } else {
+            LOG_INFO("FXSR support detected -> Using FXSAVE/FXRSTR for FPU context switching");
+        }
     } else {
         LOG_INFO("FXSR is not supported -> Falling back to FNSAVE/FRSTR for FPU context switching");
-        asm volatile (
-                "fninit;"
-                "fnsave %0;"
-                : "=m"(*defaultFpuContext)
-                );
     }
 }
 
+void Fpu::enableExtendedStates() const {
+    if (xsaveAvailable) {
+        Device::Cpu::writeXcr0(xsaveComponents);
+    }
+}
+
+void Fpu::initializeContext(uint8_t *context) const {
+    asm volatile ("fninit");
+    save(context, false);
+}
+
+uint32_t Fpu::getContextSize() const {
+    return contextSize;
+}
+
 bool Fpu::isAvailable() {
     auto cpuInfo = Util::Hardware::CpuId::getCpuInfo();
     if (cpuInfo.features & Util::Hardware::CpuId::FPU) {
@@ -89,6 +116,11 @@ bool Fpu::isFxsrAvailable() {
     return (cpuInfo.features & Util::Hardware::CpuId::FXSR) != 0;
 }
 
+bool Fpu::isXsaveAvailable() {
+    auto cpuInfo = Util::Hardware::CpuId::getCpuInfo();
+    return (cpuInfo.features & Util::Hardware::CpuId::XSAVE) != 0 && Util::Hardware::CpuId::getXsaveInfo().supportedComponents != 0;
+}
+
 bool Fpu::probeFpu() {
     uint16_t fpuStatus = 0x1797;
     asm volatile (
@@ -110,31 +142,76 @@ void Fpu::switchContext() const {
     auto &currentThread = scheduler.getCurrentThread();
     auto *lastFpuThread = scheduler.getLastFpuThread();
 
-    if (fxsrAvailable) {
-        if (lastFpuThread != nullptr) {
+    if (lastFpuThread != nullptr) {
+        // The last FPU thread's context has been restored on this CPU, which is the precondition for XSAVEOPT
+        save(lastFpuThread->getFpuContext(), true);
+    }
+
+    restore(currentThread.getFpuContext());
+}
+
+void Fpu::saveContext(uint8_t *context) const {
+    // The FPU monitor may be armed -> Disarm it temporarily, so that saving the registers does not trap
+    auto cr0 = Cpu::readCr0();
+    Cpu::writeCr0(cr0 & ~(Cpu::MONITOR_COPROCESSOR | Cpu::TASK_SWITCHED));
+
+    // The context is going to be restored on another CPU -> Write the complete state
+    save(context, false);
+
+    Cpu::writeCr0(cr0);
+}
+
+void Fpu::save(uint8_t *context, bool optimized) const {
+    if (xsaveAvailable) {
+        auto low = static_cast<uint32_t>(xsaveComponents);
+        auto high = static_cast<uint32_t>(xsaveComponents >> 32);
+        if (optimized && xsaveoptAvailable) {
             asm volatile (
-                    "fxsave %0;"
-                    : "=m"(*lastFpuThread->getFpuContext())
+                    "xsaveopt %0;"
+                    : "=m"(*context)
+                    : "a"(low), "d"(high)
+                    : "memory"
+                    );
+        } else {
+            asm volatile (
+                    "xsave %0;"
+                    : "=m"(*context)
+                    : "a"(low), "d"(high)
+                    : "memory"
                     );
         }
+    } else if (fxsrAvailable) {
+        asm volatile (
+                "fxsave %0;"
+                : "=m"(*context)
+                );
+    } else {
+        asm volatile (
+                "fnsave %0;"
+                : "=m"(*context)
+                );
+    }
+}
 
+void Fpu::restore(const uint8_t *context) const {
+    if (xsaveAvailable) {
+        asm volatile (
+                "xrstor %0;"
+                : :
+                "m"(*context), "a"(static_cast<uint32_t>(xsaveComponents)), "d"(static_cast<uint32_t>(xsaveComponents >> 32))
+                : "memory"
+                );
+    } else if (fxsrAvailable) {
         asm volatile (
                 "fxrstor %0"
                 : :
-                "m"(*currentThread.getFpuContext())
+                "m"(*context)
                 );
     } else {
-        if (lastFpuThread != nullptr) {
-            asm volatile (
-                    "fnsave %0;"
-                    : "=m"(*lastFpuThread->getFpuContext())
-                    );
-        }
-
         asm volatile (
                 "frstor %0"
                 : :
-                "m"(*currentThread.getFpuContext())
+                "m"(*context)
                 );
     }
 }
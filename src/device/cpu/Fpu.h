@@ -23,6 +23,8 @@
 
 #include <stdint.h>
 
+#include "lib/util/hardware/CpuId.h"
+
 namespace Device {
 
 class Fpu {
@@ -30,8 +32,9 @@ class Fpu {
 public:
     /**
      * Constructor.
+     * Detects the supported context switching mechanism (FNSAVE, FXSAVE or XSAVE) and enables it on the calling CPU.
      */
-    explicit Fpu(uint8_t *defaultFpuContext);
+    Fpu();
 
     /**
      * Copy Constructor.
@@ -52,15 +55,60 @@ public:
 
     static bool isFxsrAvailable();
 
+    static bool isXsaveAvailable();
+
     static void armFpuMonitor();
 
     static void disarmFpuMonitor();
 
+    /**
+     * Enable the XSAVE state components on the calling CPU.
+     * XCR0 is not shared between CPUs, so this needs to be called once on every CPU, before it uses the FPU.
+     */
+    void enableExtendedStates() const;
+
+    /**
+     * Reset the FPU of the calling CPU and save the initial state into the given context.
+     * The context is used as a template for new threads.
+     *
+     * @param context A buffer of at least getContextSize() bytes, aligned to CONTEXT_ALIGNMENT
+     */
+    void initializeContext(uint8_t *context) const;
+
+    /**
+     * Get the size of an FPU context in bytes.
+     * With XSAVE, this depends on the state components supported by the CPU (e.g. AVX registers).
+     */
+    [[nodiscard]] uint32_t getContextSize() const;
+
     void switchContext() const;
 
+    /**
+     * Save the FPU registers of the calling CPU into the given context.
+     * This is necessary before a thread, whose FPU state is still loaded on this CPU, can be migrated to another CPU.
+     *
+     * @param context The FPU context of the thread, that used the FPU last on this CPU
+     */
+    void saveContext(uint8_t *context) const;
+
     static bool probeFpu();
 
     bool fxsrAvailable = false;
+    bool xsaveAvailable = false;
+    bool xsaveoptAvailable = false;
+
+    static const constexpr uint32_t CONTEXT_ALIGNMENT = 64;
+
+private:
+
+    void save(uint8_t *context, bool optimized) const;
+
+    void restore(const uint8_t *context) const;
+
+    uint64_t xsaveComponents = 0;
+    uint32_t contextSize = 512;
+
+    static const constexpr uint64_t AVX512_COMPONENTS = Util::Hardware::CpuId::OPMASK_STATE | Util::Hardware::CpuId::ZMM_HI256_STATE | Util::Hardware::CpuId::HI16_ZMM_STATE;
 };
 
 }
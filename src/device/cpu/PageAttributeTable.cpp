@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "PageAttributeTable.h"
+
+#include "device/cpu/ModelSpecificRegister.h"
+#include "lib/util/hardware/CpuId.h"
+
+namespace Device {
+
+bool PageAttributeTable::writeCombiningEnabled = false;
+
+bool PageAttributeTable::isAvailable() {
+    return Util::Hardware::CpuId::isAvailable() && (Util::Hardware::CpuId::getCpuInfo().features & Util::Hardware::CpuId::PAT) != 0;
+}
+
+void PageAttributeTable::initialize() {
+    if (!isAvailable()) {
+        return;
+    }
+
+    // Entry n is selected by (PAT << 2 | CACHE_DISABLE << 1 | WRITE_THROUGH) and occupies byte n of the MSR.
+    // No page uses WRITE_THROUGH without CACHE_DISABLE yet, so no caches or TLB entries need to be flushed.
+    const uint8_t memoryTypes[8] = { WRITE_BACK, WRITE_COMBINING, UNCACHED, UNCACHEABLE, WRITE_BACK, WRITE_COMBINING, UNCACHED, UNCACHEABLE };
+
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < sizeof(memoryTypes); i++) {
+        value |= static_cast<uint64_t>(memoryTypes[i]) << (i * 8);
+    }
+
+    ModelSpecificRegister(MSR_ADDRESS).writeQuadWord(value);
+    writeCombiningEnabled = true;
+}
+
+bool PageAttributeTable::isWriteCombiningEnabled() {
+    return writeCombiningEnabled;
+}
+
+}
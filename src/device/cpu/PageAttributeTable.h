@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PAGEATTRIBUTETABLE_H
+#define HHUOS_PAGEATTRIBUTETABLE_H
+
+#include <stdint.h>
+
+namespace Device {
+
+/**
+ * The page attribute table (PAT) selects the memory type of a page from its PAT, CACHE_DISABLE and WRITE_THROUGH bits.
+ * We keep the power-on defaults, except for the entries selected by WRITE_THROUGH alone, which are changed from
+ * write-through to write-combining. Write-combining is meant for frame buffers, which are mostly written sequentially.
+ * Uncached mappings (CACHE_DISABLE) are not affected.
+ */
+class PageAttributeTable {
+
+public:
+
+    enum MemoryType : uint8_t {
+        UNCACHEABLE = 0x00,
+        WRITE_COMBINING = 0x01,
+        WRITE_THROUGH = 0x04,
+        WRITE_PROTECTED = 0x05,
+        WRITE_BACK = 0x06,
+        UNCACHED = 0x07
+    };
+
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    PageAttributeTable() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    PageAttributeTable(const PageAttributeTable &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    PageAttributeTable &operator=(const PageAttributeTable &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~PageAttributeTable() = default;
+
+    static bool isAvailable();
+
+    /**
+     * Program the page attribute table of the calling CPU.
+     * The PAT is not shared between CPUs, so this needs to be called once on every CPU,
+     * before it accesses a write-combining mapping. All CPUs must use the same memory types.
+     */
+    static void initialize();
+
+    /**
+     * Check if write-combining mappings are possible (i.e. the page attribute table has been programmed).
+     * Otherwise, WRITE_THROUGH selects the write-through memory type.
+     */
+    static bool isWriteCombiningEnabled();
+
+private:
+
+    static bool writeCombiningEnabled;
+
+    static const constexpr uint32_t MSR_ADDRESS = 0x277;
+};
+
+}
+
+#endif
@@ -24,31 +24,58 @@
 #include "SymmetricMultiprocessing.h"
 
 #include "util/async/Thread.h"
+#include "device/cpu/PageAttributeTable.h"
 #include "kernel/log/Log.h"
 #include "kernel/memory/MemoryLayout.h"
 #include "kernel/memory/VirtualAddressSpace.h"
 #include "lib/util/base/Constants.h"
 #include "device/interrupt/apic/Apic.h"
 #include "kernel/service/InterruptService.h"
+#include "kernel/service/CpuService.h"
+#include "kernel/service/MemoryService.h"
 #include "kernel/service/Service.h"
 #include "kernel/service/TimeService.h"
 #include "util/math/Random.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/process/Scheduler.h"
+#include "lib/util/base/Panic.h"
 
 namespace Device {
 
 volatile bool runningApplicationProcessors[256]{}; // Once an AP is running it sets its corresponding entry to true
 
 [[noreturn]] void applicationProcessorEntry(uint8_t virtualCpuId) {
+    // The page attribute table is not copied from the bootstrap processor, but all CPUs must use the same memory types
+    PageAttributeTable::initialize();
+
     // Initialize this AP's APIC
     auto &interruptService = Kernel::Service::getService<Kernel::InterruptService>();
     auto &apic = interruptService.getApic();
     apic.initializeCurrentLocalApic();
     apic.enableCurrentErrorHandler();
 
+    // Model specific registers are not shared between CPUs, so each CPU needs its own SYSENTER configuration
+    Kernel::Service::getService<Kernel::CpuService>().enableFastSystemCalls();
+
+    // Start this AP's timer (APs are booted one at a time, so registering the timer interrupt handler is not racy).
+    // Interrupts are still disabled, so the timer will not interrupt us until the first thread has been started.
+    apic.startCurrentTimer();
+
+    // Create this AP's run queue, before it becomes visible to the other CPUs
+    auto &scheduler = Kernel::Service::getService<Kernel::ProcessService>().getScheduler();
+    scheduler.registerCurrentCpu();
+
     // Mark this AP as running
     runningApplicationProcessors[virtualCpuId] = true;
 
-    while (true) {}
+    // Wait for the bootstrap processor to start the scheduler and start scheduling threads on this AP.
+    // The AP's ready queue is empty at first, so it runs its idle thread until new threads are assigned to it.
+    while (!scheduler.isInitialized()) {}
+
+    // Receive TLB shootdowns from now on. Interrupts are enabled as soon as the first thread runs.
+    Kernel::Service::getService<Kernel::MemoryService>().registerCurrentCpu();
+    scheduler.start();
+    Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Scheduler returned on application processor!");
 }
 
 }
@@ -96,6 +96,10 @@ Apic* Apic::initialize() {
     apic->errorHandler.plugin();
     apic->enableCurrentErrorHandler();
 
+    // IPIs are always accepted by the local APIC, so the IPI handlers do not need to be enabled per AP
+    apic->wakeupHandler.plugin();
+    apic->tlbShootdownHandler.plugin();
+
     return apic;
 }
 
@@ -158,7 +162,7 @@ void Apic::sendEndOfInterrupt(Kernel::InterruptVector vector) {
 }
 
 bool Apic::isLocalInterrupt(Kernel::InterruptVector vector) const {
-    return vector >= Kernel::InterruptVector::CMCI && vector <= Kernel::InterruptVector::ERROR;
+    return vector >= Kernel::InterruptVector::TLB_SHOOTDOWN && vector <= Kernel::InterruptVector::ERROR;
 }
 
 bool Apic::isExternalInterrupt(Kernel::InterruptVector vector) const {
@@ -28,6 +28,8 @@
 
 #include "LocalApic.h"
 #include "LocalApicErrorHandler.h"
+#include "LocalApicWakeupHandler.h"
+#include "LocalApicTlbShootdownHandler.h"
 #include "lib/util/collection/HashMap.h"
 #include "lib/util/collection/Array.h"
 #include "kernel/memory/GlobalDescriptorTable.h"
@@ -182,6 +184,8 @@ private:
     Util::Array<LocalApic*> localApics;  // All LocalApic instances.
     IoApic *ioApic;                      // The IoApic instance responsible for the external interrupts.
     LocalApicErrorHandler errorHandler;  // The interrupt handler that gets triggered on an internal APIC error.
+    LocalApicWakeupHandler wakeupHandler; // The interrupt handler for wakeup IPIs, sent to halted CPUs.
+    LocalApicTlbShootdownHandler tlbShootdownHandler; // The interrupt handler for TLB shootdown IPIs.
 
 };
 
@@ -26,6 +26,7 @@
 #include "lib/util/hardware/CpuId.h"
 #include "kernel/service/InterruptService.h"
 #include "kernel/service/MemoryService.h"
+#include "device/cpu/Cpu.h"
 #include "device/cpu/IoPort.h"
 #include "device/cpu/ModelSpecificRegister.h"
 #include "kernel/interrupt/InterruptVector.h"
@@ -202,10 +203,10 @@ void LocalApic::writeLocalVectorTable(LocalApic::LocalInterrupt lint, const Loca
 }
 
 LocalApic::InterruptCommandRegisterEntry LocalApic::readInterruptCommandRegister() {
-    commandLock.acquire(); // This needs to be synchronized in case multiple APs issue IPIs
+    auto flags = lockCommandRegister();
     const uint32_t low = readDoubleWord(ICR_LOW);
     const uint64_t high = readDoubleWord(ICR_HIGH);
-    commandLock.release();
+    unlockCommandRegister(flags);
 
     return InterruptCommandRegisterEntry(low | high << 32);
 
@@ -214,10 +215,26 @@ LocalApic::InterruptCommandRegisterEntry LocalApic::readInterruptCommandRegister
 void LocalApic::writeInterruptCommandRegister(const LocalApic::InterruptCommandRegisterEntry &icrEntry) {
     auto value = static_cast<uint64_t>(icrEntry);
 
-    commandLock.acquire(); // This needs to be synchronized in case multiple APs issue IPIs
+    auto flags = lockCommandRegister();
     writeDoubleWord(ICR_HIGH, value >> 32);
     writeDoubleWord(ICR_LOW, value & 0xFFFFFFFF); // Writing the low DW sends the IPI
+    unlockCommandRegister(flags);
+}
+
+uint32_t LocalApic::lockCommandRegister() {
+    // This needs to be synchronized in case multiple APs issue IPIs.
+    // Wakeup IPIs are also sent from interrupt handlers, so the lock must never be held with interrupts enabled.
+    auto flags = Cpu::saveAndDisableInterrupts();
+    while (!commandLock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
+    return flags;
+}
+
+void LocalApic::unlockCommandRegister(uint32_t flags) {
     commandLock.release();
+    Cpu::restoreInterrupts(flags);
 }
 
 void LocalApic::allow(LocalApic::LocalInterrupt lint) {
@@ -272,6 +289,30 @@ void LocalApic::sendStartupInterProcessorInterrupt(uint8_t id, uint32_t startupC
     writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
 }
 
+void LocalApic::sendWakeupInterProcessorInterrupt(uint8_t id) {
+    InterruptCommandRegisterEntry icrEntry{};
+    icrEntry.vector = Kernel::InterruptVector::WAKEUP;
+    icrEntry.deliveryMode = InterruptCommandRegisterEntry::DeliveryMode::FIXED;
+    icrEntry.destinationMode = InterruptCommandRegisterEntry::DestinationMode::PHYSICAL;
+    icrEntry.level = InterruptCommandRegisterEntry::Level::ASSERT;
+    icrEntry.triggerMode = InterruptCommandRegisterEntry::TriggerMode::EDGE;
+    icrEntry.destinationShorthand = InterruptCommandRegisterEntry::DestinationShorthand::NO;
+    icrEntry.destination = id;
+    writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
+}
+
+void LocalApic::sendTlbShootdownInterProcessorInterrupt(uint8_t id) {
+    InterruptCommandRegisterEntry icrEntry{};
+    icrEntry.vector = Kernel::InterruptVector::TLB_SHOOTDOWN;
+    icrEntry.deliveryMode = InterruptCommandRegisterEntry::DeliveryMode::FIXED;
+    icrEntry.destinationMode = InterruptCommandRegisterEntry::DestinationMode::PHYSICAL;
+    icrEntry.level = InterruptCommandRegisterEntry::Level::ASSERT;
+    icrEntry.triggerMode = InterruptCommandRegisterEntry::TriggerMode::EDGE;
+    icrEntry.destinationShorthand = InterruptCommandRegisterEntry::DestinationShorthand::NO;
+    icrEntry.destination = id;
+    writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
+}
+
 void LocalApic::waitForInterProcessorInterruptDispatch() {
     do {
         // Spinloop: Pause prevents speculative memory reads, memory prevents compiler memory reordering,
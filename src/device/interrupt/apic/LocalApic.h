@@ -351,6 +351,22 @@ public:
      */
     static void sendStartupInterProcessorInterrupt(uint8_t id, uint32_t startupCodeAddress);
 
+    /**
+     * Send a wakeup IPI to another CPU, to end its halt state (see Kernel::Scheduler::idle()).
+     * Safe to be called from interrupt handlers.
+     *
+     * @param id The local APIC id/CPU id of the target CPU
+     */
+    static void sendWakeupInterProcessorInterrupt(uint8_t id);
+
+    /**
+     * Send a TLB shootdown IPI to another CPU, to make it invalidate the TLB entries requested by
+     * Kernel::MemoryService::invalidateTlbEntries().
+     *
+     * @param id The local APIC id/CPU id of the target CPU
+     */
+    static void sendTlbShootdownInterProcessorInterrupt(uint8_t id);
+
     /**
      * Poll the ICR until the delivery status bit is unset.
      */
@@ -423,6 +439,10 @@ public:
      */
     static void writeInterruptCommandRegister(const InterruptCommandRegisterEntry &icrEntry); // Issue IPIs
 
+    static uint32_t lockCommandRegister();
+
+    static void unlockCommandRegister(uint32_t flags);
+
     /**
      * Prepare the BSP for local APIC initialization.
      *
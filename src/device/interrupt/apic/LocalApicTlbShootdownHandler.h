@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LOCALAPICTLBSHOOTDOWNHANDLER_H
+#define HHUOS_LOCALAPICTLBSHOOTDOWNHANDLER_H
+
+#include <stdint.h>
+
+#include "kernel/interrupt/InterruptHandler.h"
+
+namespace Kernel {
+enum InterruptVector : uint8_t;
+struct InterruptFrame;
+}  // namespace Kernel
+
+namespace Device {
+
+/**
+ * Handles the TLB shootdown IPI, which is sent to other CPUs, after a page has been unmapped or write protected.
+ * The entries to invalidate are requested and acknowledged via the memory service (see Kernel::MemoryService::invalidateTlbEntries()).
+ */
+class LocalApicTlbShootdownHandler : public Kernel::InterruptHandler {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    LocalApicTlbShootdownHandler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    LocalApicTlbShootdownHandler(const LocalApicTlbShootdownHandler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    LocalApicTlbShootdownHandler &operator=(const LocalApicTlbShootdownHandler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~LocalApicTlbShootdownHandler() override = default;
+
+    /**
+     * Overriding function from InterruptHandler.
+     */
+    void plugin() override;
+
+    /**
+     * Overriding function from InterruptHandler.
+     */
+    void trigger(const Kernel::InterruptFrame &frame, Kernel::InterruptVector slot) override;
+};
+
+}
+
+#endif
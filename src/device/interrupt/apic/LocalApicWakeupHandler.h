@@ -18,63 +18,56 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>
  */
 
-#ifndef HHUOS_SLABALLOCATOR_H
-#define HHUOS_SLABALLOCATOR_H
+#ifndef HHUOS_LOCALAPICWAKEUPHANDLER_H
+#define HHUOS_LOCALAPICWAKEUPHANDLER_H
 
 #include <stdint.h>
 
-#include "lib/util/base/BitmapMemoryManager.h"
-#include "lib/util/base/MemoryManager.h"
+#include "kernel/interrupt/InterruptHandler.h"
 
 namespace Kernel {
+enum InterruptVector : uint8_t;
+struct InterruptFrame;
+}  // namespace Kernel
 
-class SlabAllocator : public Util::MemoryManager {
+namespace Device {
+
+/**
+ * Handles the wakeup IPI, which is sent to a halted CPU, when another CPU enqueues a thread into its ready queue.
+ * The interrupt itself only ends the halt, after which the idle thread runs the scheduler again.
+ */
+class LocalApicWakeupHandler : public Kernel::InterruptHandler {
 
 public:
     /**
      * Default Constructor.
      */
-    explicit SlabAllocator(uint8_t *slabMemory);
+    LocalApicWakeupHandler() = default;
 
     /**
      * Copy Constructor.
      */
-    SlabAllocator(const SlabAllocator &other) = delete;
+    LocalApicWakeupHandler(const LocalApicWakeupHandler &other) = delete;
 
     /**
      * Assignment operator.
      */
-    SlabAllocator &operator=(const SlabAllocator &other) = delete;
+    LocalApicWakeupHandler &operator=(const LocalApicWakeupHandler &other) = delete;
 
     /**
      * Destructor.
      */
-    ~SlabAllocator() override = default;
-
-    void *allocateBlock(uint32_t frameCount);
-
-    bool freeBlock(void *pointer);
-
-    uint32_t getTotalMemory() const override;
-
-    uint32_t getFreeMemory() const override;
-
-    void* getStartAddress() const override;
+    ~LocalApicWakeupHandler() override = default;
 
-    void* getEndAddress() const override;
-
-    static const constexpr uint32_t MAX_SLAB_SIZE = 128 * 1024;
-
-private:
-
-    Util::BitmapMemoryManager pool4K;
-    Util::BitmapMemoryManager pool8K;
-    Util::BitmapMemoryManager pool16K;
-    Util::BitmapMemoryManager pool32K;
-    Util::BitmapMemoryManager pool64K;
-    Util::BitmapMemoryManager pool128K;
+    /**
+     * Overriding function from InterruptHandler.
+     */
+    void plugin() override;
 
-    static const constexpr uint32_t POOL_SIZE = 1 * 1024 * 1024;
+    /**
+     * Overriding function from InterruptHandler.
+     */
+    void trigger(const Kernel::InterruptFrame &frame, Kernel::InterruptVector slot) override;
 };
 
 }
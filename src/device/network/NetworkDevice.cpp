@@ -46,6 +46,8 @@ NetworkDevice::NetworkDevice() :
     auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
     auto &readerThread = Kernel::Thread::createKernelThread("Packet-Reader", processService.getKernelProcess(), reader);
 
+    // Keep the reader on the bootstrap processor, which receives the interrupts of the network devices
+    processService.getScheduler().setAffinity(readerThread, 0x01);
     processService.getScheduler().ready(readerThread);
 }
 
@@ -85,6 +87,8 @@ void NetworkDevice::sendPacket(const uint8_t *packet, uint32_t length) {
     outgoingPacketQueue.add(Packet{buffer, length});
     handleOutgoingPacket(buffer, length);
     outgoingPacketLock.release();
+
+    outgoingPacketWaitQueue.wake();
 }
 
 void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length) {
@@ -107,22 +111,33 @@ void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length)
 
     if (!incomingPacketQueue.offer(Packet{buffer, length})) {
         incomingPacketMemoryManager.freeBlock(buffer);
+        return;
     }
+
+    incomingPacketWaitQueue.wake();
 }
 
 NetworkDevice::Packet NetworkDevice::getNextIncomingPacket() {
+    // Packets are queued by the interrupt handler, which cannot take a lock held by this thread.
+    // Registering as waiter before checking the queue makes sure that no wakeup gets lost.
+    incomingPacketWaitQueue.prepareToWait();
     while (incomingPacketQueue.isEmpty()) {
-        Util::Async::Thread::yield();
+        incomingPacketWaitQueue.wait();
+        incomingPacketWaitQueue.prepareToWait();
     }
 
+    incomingPacketWaitQueue.cancelWait();
     return incomingPacketQueue.poll();
 }
 
 NetworkDevice::Packet NetworkDevice::getNextOutgoingPacket() {
+    outgoingPacketWaitQueue.prepareToWait();
     while (outgoingPacketQueue.isEmpty()) {
-        Util::Async::Thread::yield();
+        outgoingPacketWaitQueue.wait();
+        outgoingPacketWaitQueue.prepareToWait();
     }
 
+    outgoingPacketWaitQueue.cancelWait();
     return outgoingPacketQueue.poll();
 }
 
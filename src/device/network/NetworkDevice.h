@@ -26,6 +26,7 @@
 #include "lib/util/collection/ArrayQueue.h"
 #include "lib/util/network/MacAddress.h"
 #include "lib/util/async/Spinlock.h"
+#include "kernel/process/WaitQueue.h"
 #include "lib/util/base/String.h"
 #include "lib/util/base/Constants.h"
 
@@ -113,6 +114,8 @@ private:
     Util::ArrayQueue<Packet> incomingPacketQueue;
     Util::ArrayQueue<Packet> outgoingPacketQueue;
     Util::Async::Spinlock outgoingPacketLock;
+    Kernel::WaitQueue incomingPacketWaitQueue;
+    Kernel::WaitQueue outgoingPacketWaitQueue;
     uint32_t outgoingPacketsToFree = 0;
 
     PacketReader *reader;
@@ -31,6 +31,8 @@
 #include "kernel/service/ProcessService.h"
 #include "kernel/process/Scheduler.h"
 #include "kernel/service/TimeService.h"
+#include "device/cpu/Cpu.h"
+#include "lib/util/base/Panic.h"
 
 namespace Kernel {
 struct InterruptFrame;
@@ -39,17 +41,27 @@ struct InterruptFrame;
 namespace Device {
 
 uint32_t ApicTimer::BASE_FREQUENCY = 0;
+bool ApicTimer::TICKLESS = true;
 
-ApicTimer::ApicTimer(Util::Time::Timestamp timerInterval, Util::Time::Timestamp yieldInterval) : cpuId(LocalApic::getId()), timerInterval(timerInterval), yieldInterval(yieldInterval) {
+ApicTimer::ApicTimer(Util::Time::Timestamp timerInterval, Util::Time::Timestamp yieldInterval) : cpuId(LocalApic::getId()), timerInterval(timerInterval), yieldInterval(yieldInterval), tickless(TICKLESS) {
     auto counter = (BASE_FREQUENCY / 1000) * timerInterval.toMilliseconds();
-    LOG_INFO("Setting APIC timer [%u] interval to [%ums] (Counter: [%u])", cpuId, static_cast<uint32_t>(timerInterval.toMilliseconds()), static_cast<uint32_t>(counter));
+    if (tickless) {
+        LOG_INFO("Setting APIC timer [%u] to tickless mode (Default interval: [%ums])", cpuId, static_cast<uint32_t>(timerInterval.toMilliseconds()));
+    } else {
+        LOG_INFO("Setting APIC timer [%u] interval to [%ums] (Counter: [%u])", cpuId, static_cast<uint32_t>(timerInterval.toMilliseconds()), static_cast<uint32_t>(counter));
+    }
 
     // Recommended order: Divide -> LVT -> Initial Count (OSDev)
     LocalApic::writeDoubleWord(LocalApic::TIMER_DIVIDE, Divider::BY_1);
     LocalApic::LocalVectorTableEntry lvtEntry = LocalApic::readLocalVectorTable(LocalApic::TIMER);
-    lvtEntry.timerMode = LocalApic::LocalVectorTableEntry::TimerMode::PERIODIC;
+    lvtEntry.timerMode = tickless ? LocalApic::LocalVectorTableEntry::TimerMode::ONESHOT : LocalApic::LocalVectorTableEntry::TimerMode::PERIODIC;
     LocalApic::writeLocalVectorTable(LocalApic::TIMER, lvtEntry);
-    LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, counter);
+
+    if (tickless) {
+        arm(timerInterval);
+    } else {
+        LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, counter);
+    }
 }
 
 void ApicTimer::plugin() {
@@ -66,20 +78,29 @@ void ApicTimer::trigger([[maybe_unused]] const Kernel::InterruptFrame &frame, [[
     }
 
     // Increase the "core-local" time, the system time is still managed by the PIT/HPET.
-    time += timerInterval;
+    accountElapsedTime();
+    if (tickless) {
+        // Make sure the timer keeps firing, even if the scheduler does not reprogram it (e.g. because its lock is held)
+        arm(timerInterval);
+    }
 
-    if (cpuId != 0) {
-        // Currently there is only one scheduler, it should get triggered only by the BSP.
-        // Otherwise, the scheduler would be triggered n-times faster than intended, where n
-        // is the CPU count.
-        return;
+    // Periodically pull threads from busier cores, so that work spreads evenly even if no core is idle
+    if (timeSinceLastBalance >= Util::Time::Timestamp::ofMilliseconds(BALANCE_INTERVAL)) {
+        timeSinceLastBalance = Util::Time::Timestamp();
+        Kernel::Service::getService<Kernel::ProcessService>().getScheduler().balance();
     }
 
-    timeSinceLastYield += timerInterval;
-    if (timeSinceLastYield >= yieldInterval) {
-        timeSinceLastYield = Util::Time::Timestamp();
-        // Currently there is only one main scheduler, for SMP systems this should yield the core scheduler or something similar.
-        Kernel::Service::getService<Kernel::ProcessService>().getScheduler().yield(true);
+    // In tickless mode, the interrupt may also be caused by a sleeping thread that needs to be woken up.
+    // In this case, no full preemption interval may have passed, but the scheduler needs to run anyway.
+    if (tickless || timeSinceLastYield >= yieldInterval) {
+        uint32_t intervals = 0;
+        while (timeSinceLastYield >= yieldInterval) {
+            timeSinceLastYield -= yieldInterval;
+            intervals++;
+        }
+
+        // Every core has its own ready queue -> The scheduler switches threads on the core this interrupt arrived at
+        Kernel::Service::getService<Kernel::ProcessService>().getScheduler().yield(true, intervals);
     }
 }
 
@@ -108,8 +129,65 @@ void ApicTimer::calibrate() {
     LOG_INFO("Apic Timer frequency: [%u MHz]", BASE_FREQUENCY / 1000000);
 }
 
+void ApicTimer::setTicklessMode(bool enabled) {
+    TICKLESS = enabled;
+}
+
+bool ApicTimer::isTickless() const {
+    return tickless;
+}
+
+void ApicTimer::setNextEvent(const Util::Time::Timestamp &delay) {
+    if (!tickless) {
+        Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "ApicTimer: Cannot program next event in periodic mode!");
+    }
+
+    // The timer interrupt must not arrive in between accounting and arming the counter
+    auto flags = Cpu::saveAndDisableInterrupts();
+    accountElapsedTime();
+
+    // Wake up in time for the next load balancing round
+    auto balanceInterval = Util::Time::Timestamp::ofMilliseconds(BALANCE_INTERVAL);
+    auto maxDelay = timeSinceLastBalance < balanceInterval ? balanceInterval - timeSinceLastBalance : Util::Time::Timestamp();
+    arm(delay < maxDelay ? delay : maxDelay);
+
+    Cpu::restoreInterrupts(flags);
+}
+
+Util::Time::Timestamp ApicTimer::getTimeUntilYield(uint32_t intervals) const {
+    auto interval = yieldInterval * intervals;
+    return interval > timeSinceLastYield ? interval - timeSinceLastYield : Util::Time::Timestamp();
+}
+
 uint8_t ApicTimer::getCpuId() const {
     return cpuId;
 }
 
+void ApicTimer::accountElapsedTime() {
+    auto elapsed = timerInterval;
+    if (tickless) {
+        // The counter keeps counting down until it reaches zero -> Only account the ticks since the last call
+        auto currentCounter = LocalApic::readDoubleWord(LocalApic::TIMER_CURRENT);
+        elapsed = Util::Time::Timestamp::ofNanoseconds(static_cast<uint64_t>(armedCounter - currentCounter) * 1000000000 / BASE_FREQUENCY);
+        armedCounter = currentCounter;
+    }
+
+    time += elapsed;
+    timeSinceLastYield += elapsed;
+    timeSinceLastBalance += elapsed;
+}
+
+void ApicTimer::arm(const Util::Time::Timestamp &delay) {
+    auto counter = delay.toNanoseconds() * BASE_FREQUENCY / 1000000000;
+    if (counter == 0) {
+        counter = 1;
+    } else if (counter > 0xffffffff) {
+        counter = 0xffffffff;
+    }
+
+    // Writing the initial counter restarts the countdown
+    armedCounter = static_cast<uint32_t>(counter);
+    LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, armedCounter);
+}
+
 }
\ No newline at end of file
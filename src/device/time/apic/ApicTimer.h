@@ -45,6 +45,10 @@ namespace Device {
  *
  * It receives its tick interval in milliseconds, which should be precise enough for scheduling.
  * If a more precise interval is required, the timer divider might need adjustment.
+ *
+ * In tickless mode, the timer runs in one-shot mode instead of firing periodically.
+ * After each interrupt, it is armed for one tick interval, but the scheduler reprograms it via setNextEvent()
+ * to the earliest point in time, at which it needs to run again (end of the current time slice or next sleeper wakeup).
  */
 class ApicTimer : public Kernel::InterruptHandler, public TimeProvider {
 
@@ -115,17 +119,58 @@ public:
      */
     static void calibrate();
 
+    /**
+     * Enable or disable tickless mode for all timers, that are constructed afterward.
+     */
+    static void setTicklessMode(bool enabled);
+
+    /**
+     * Check if this timer runs in tickless (one-shot) mode.
+     */
+    [[nodiscard]] bool isTickless() const;
+
+    /**
+     * Program the next timer interrupt to occur after the given delay.
+     * The delay is limited by the load balancing interval and the range of the counter register.
+     * Only available in tickless mode.
+     *
+     * @param delay The time until the next interrupt
+     */
+    void setNextEvent(const Util::Time::Timestamp &delay);
+
+    /**
+     * Get the time that remains until the given amount of preemption intervals has passed.
+     */
+    [[nodiscard]] Util::Time::Timestamp getTimeUntilYield(uint32_t intervals) const;
+
     uint8_t getCpuId() const;
 
 private:
+
+    /**
+     * Add the time that has passed since the counter has been armed to the core-local time.
+     */
+    void accountElapsedTime();
+
+    /**
+     * Start the counter in one-shot mode, so that it fires after the given delay.
+     */
+    void arm(const Util::Time::Timestamp &delay);
+
     uint8_t cpuId;          // The id of the CPU that uses this timer.
     Util::Time::Timestamp timerInterval; // The interrupt trigger interval in milliseconds.
     Util::Time::Timestamp yieldInterval; // The preemption trigger interval in milliseconds.
     Util::Time::Timestamp timeSinceLastYield;
+    Util::Time::Timestamp timeSinceLastBalance;
 
     Util::Time::Timestamp time{}; // The "core-local" timestamp.
 
+    bool tickless;              // Whether this timer runs in one-shot mode.
+    uint32_t armedCounter = 0;  // The initial counter of the currently armed one-shot interval.
+
     static uint32_t BASE_FREQUENCY; // The number of ticks the APIC timer does in 1 second
+    static bool TICKLESS;           // Whether new timers run in tickless mode.
+    static const constexpr uint32_t BALANCE_INTERVAL = 100; // The load balancing interval in milliseconds.
 };
 
 }
@@ -29,6 +29,7 @@
 #include "kernel/log/Log.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/service/InterruptService.h"
+#include "kernel/service/TimeService.h"
 #include "device/interrupt/InterruptRequest.h"
 #include "device/time/hpet/SystemTimerInterruptHandler.h"
 #include "kernel/service/Service.h"
@@ -136,6 +137,10 @@ void Hpet::pluginSystemTimer() {
     systemTimer = new Timer(*this, 0, interrupt);
     systemTimerInterruptHandler = new SystemTimerInterruptHandler(*this, *systemTimer);
 
+    // The main counter is read-only accessible from user space, which allows querying the system time without a system call
+    auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
+    Kernel::Service::getService<Kernel::TimeService>().setTimePageCounter(memoryService.getPhysicalAddress(baseAddress + MAIN_COUNTER_VALUE), femtosecondsPerTick, maxValue);
+
     systemTimer->plugin();
     systemTimerInterruptHandler->armTimer();
 }
@@ -26,6 +26,8 @@
 #include "Hpet.h"
 #include "lib/util/async/Atomic.h"
 #include "device/time/hpet/Timer.h"
+#include "kernel/service/Service.h"
+#include "kernel/service/TimeService.h"
 
 namespace Device {
 
@@ -47,6 +49,7 @@ void SystemTimerInterruptHandler::run() {
         lastCounterValue = hpet.readCounter();
         interruptCount += pendingInterrupts;
         pendingInterrupts = 0;
+        publishSystemTime();
     }
 
     timer.arm(lastCounterValue + ticksPerInterrupt, *this);
@@ -54,6 +57,7 @@ void SystemTimerInterruptHandler::run() {
 
 void SystemTimerInterruptHandler::armTimer() {
     lastCounterValue = hpet.readCounter();
+    publishSystemTime();
     timer.arm(lastCounterValue + ticksPerInterrupt, *this);
 }
 
@@ -71,4 +75,10 @@ Util::Time::Timestamp SystemTimerInterruptHandler::getTime() {
     return Util::Time::Timestamp::ofNanoseconds(((interrupts * ticksPerInterrupt + ticksSinceLastInterrupt) * hpet.getFemtosecondsPerTick()) / 1000000);
 }
 
-}
\ No newline at end of file
+void SystemTimerInterruptHandler::publishSystemTime() {
+    // User space interpolates the system time from the last interrupt, by reading the HPET counter itself
+    auto systemTime = Util::Time::Timestamp::ofNanoseconds((interruptCount * ticksPerInterrupt * hpet.getFemtosecondsPerTick()) / 1000000);
+    Kernel::Service::getService<Kernel::TimeService>().publishSystemTime(systemTime, lastCounterValue);
+}
+
+}
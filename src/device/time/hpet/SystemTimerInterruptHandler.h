@@ -64,6 +64,8 @@ public:
 
 private:
 
+    void publishSystemTime();
+
     Hpet &hpet;
     Timer &timer;
     uint64_t ticksPerInterrupt = 0;
@@ -25,6 +25,7 @@
 #include "kernel/interrupt/InterruptVector.h"
 #include "kernel/service/Service.h"
 #include "kernel/service/ProcessService.h"
+#include "kernel/service/TimeService.h"
 #include "kernel/process/Scheduler.h"
 #include "lib/util/async/Atomic.h"
 
@@ -75,6 +76,8 @@ void Pit::trigger([[maybe_unused]] const Kernel::InterruptFrame &frame, [[maybe_
             time += timerInterval;
             intervals--;
         }
+
+        Kernel::Service::getService<Kernel::TimeService>().publishSystemTime(time);
     }
 
     if (!Kernel::Service::getService<Kernel::InterruptService>().usesApic()) {
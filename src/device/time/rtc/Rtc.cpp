@@ -23,6 +23,7 @@
 #include "Cmos.h"
 #include "Rtc.h"
 #include "kernel/service/ProcessService.h"
+#include "kernel/service/TimeService.h"
 #include "device/interrupt/InterruptRequest.h"
 #include "device/system/Acpi.h"
 #include "AlarmRunnable.h"
@@ -74,6 +75,7 @@ void Rtc::trigger([[maybe_unused]] const Kernel::InterruptFrame &frame, [[maybe_
     uint8_t interruptStatus = Cmos::read(STATUS_REGISTER_C);
     if ((interruptStatus & INTERRUPT_UPDATE_ENDED) != 0) {
         currentDate = readDate();
+        Kernel::Service::getService<Kernel::TimeService>().publishCurrentDate(currentDate);
     }
 
     if ((interruptStatus & INTERRUPT_ALARM) != 0) {
@@ -40,13 +40,13 @@ bool Filesystem::mount(const Util::String &deviceName, const Util::String &targe
         return false;
     }
 
-    lock.acquire();
+    lock.acquireWrite();
 
     auto parsedPath = Util::Io::File::getCanonicalPath(targetPath) + '/';
-    auto *targetNode = getNode(parsedPath);
+    auto *targetNode = getNodeLocked(parsedPath);
     if (targetNode == nullptr) {
         if (mountPoints.size() != 0) {
-            return lock.releaseAndReturn(false);
+            return lock.releaseWriteAndReturn(false);
         }
     }
 
@@ -54,58 +54,58 @@ bool Filesystem::mount(const Util::String &deviceName, const Util::String &targe
     auto *driver = Util::Reflection::InstanceFactory::createInstance<PhysicalDriver>(driverName);
     if (driver == nullptr || !driver->mount(device)) {
         delete driver;
-        return lock.releaseAndReturn(false);
+        return lock.releaseWriteAndReturn(false);
     }
 
     if (mountPoints.containsKey(parsedPath)) {
-        return lock.releaseAndReturn(false);
+        return lock.releaseWriteAndReturn(false);
     }
 
     mountPoints.put(parsedPath, driver);
     mountInformation.put(parsedPath, {deviceName, targetPath, driverName});
-    return lock.releaseAndReturn(true);
+    return lock.releaseWriteAndReturn(true);
 }
 
 bool Filesystem::mountVirtualDriver(const Util::String &targetPath, VirtualDriver *driver) {
     auto parsedPath = Util::Io::File::getCanonicalPath(targetPath) + '/';
 
-    lock.acquire();
+    lock.acquireWrite();
 
-    auto *targetNode = getNode(parsedPath);
+    auto *targetNode = getNodeLocked(parsedPath);
     if (targetNode == nullptr) {
         if (mountPoints.size() != 0) {
-            return lock.releaseAndReturn(false);
+            return lock.releaseWriteAndReturn(false);
         }
     }
 
     delete targetNode;
 
     if (mountPoints.containsKey(parsedPath)) {
-        return lock.releaseAndReturn(false);
+        return lock.releaseWriteAndReturn(false);
     }
 
     mountPoints.put(parsedPath, driver);
     mountInformation.put(parsedPath, {"Virtual", targetPath, "VirtualDriver"});
-    return lock.releaseAndReturn(true);
+    return lock.releaseWriteAndReturn(true);
 }
 
 Memory::MemoryDriver& Filesystem::getVirtualDriver(const Util::String &path) {
-    lock.acquire();
+    lock.acquireRead();
     auto parsedPath = Util::Io::File::getCanonicalPath(path) + '/';
     auto *driver = mountPoints.get(parsedPath);
 
-    return lock.releaseAndReturn<Memory::MemoryDriver&>(*reinterpret_cast<Memory::MemoryDriver*>(driver));
+    return lock.releaseReadAndReturn<Memory::MemoryDriver&>(*reinterpret_cast<Memory::MemoryDriver*>(driver));
 }
 
 bool Filesystem::unmount(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path) + '/';
 
-    lock.acquire();
+    lock.acquireWrite();
 
-    auto *targetNode = getNode(parsedPath);
+    auto *targetNode = getNodeLocked(parsedPath);
     if (targetNode == nullptr) {
         if (path != "/") {
-            return lock.releaseAndReturn(false);
+            return lock.releaseWriteAndReturn(false);
         }
     }
 
@@ -114,7 +114,7 @@ bool Filesystem::unmount(const Util::String &path) {
     for (const Util::String &key : mountPoints.getKeys()) {
         if (key.beginsWith(parsedPath)) {
             if (key != parsedPath) {
-                return lock.releaseAndReturn(false);
+                return lock.releaseWriteAndReturn(false);
             }
         }
     }
@@ -122,10 +122,10 @@ bool Filesystem::unmount(const Util::String &path) {
     if (mountPoints.containsKey(parsedPath)) {
         mountInformation.remove(parsedPath);
         delete mountPoints.remove(parsedPath);
-        return lock.releaseAndReturn(true);
+        return lock.releaseWriteAndReturn(true);
     }
 
-    return lock.releaseAndReturn(false);
+    return lock.releaseWriteAndReturn(false);
 }
 
 bool Filesystem::createFilesystem(const Util::String &deviceName, const Util::String &driverName) {
@@ -134,73 +134,75 @@ bool Filesystem::createFilesystem(const Util::String &deviceName, const Util::St
         return false;
     }
 
-    lock.acquire();
+    lock.acquireWrite();
 
     auto &device = storageService.getDevice(deviceName);
     auto *driver = Util::Reflection::InstanceFactory::createInstance<PhysicalDriver>(driverName);
     auto result = driver->createFilesystem(device);
 
     delete driver;
-    return lock.releaseAndReturn(result);
+    return lock.releaseWriteAndReturn(result);
 }
 
 Node* Filesystem::getNode(const Util::String &path) {
-    auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireRead();
+    return lock.releaseReadAndReturn(getNodeLocked(path));
+}
 
+Node* Filesystem::getNodeLocked(const Util::String &path) {
+    auto parsedPath = Util::Io::File::getCanonicalPath(path);
     auto *driver = getMountedDriver(parsedPath);
     if (driver == nullptr) {
-        return lock.releaseAndReturn(nullptr);
+        return nullptr;
     }
 
-    Node *ret = driver->getNode(parsedPath);
-    return lock.releaseAndReturn(ret);
+    return driver->getNode(parsedPath);
 }
 
 bool Filesystem::createFile(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireWrite();
 
     auto *driver = getMountedDriver(parsedPath);
     if (driver == nullptr) {
-        return lock.releaseAndReturn(false);
+        return lock.releaseWriteAndReturn(false);
     }
 
     bool ret = driver->createNode(parsedPath, Util::Io::File::REGULAR);
-    return lock.releaseAndReturn(ret);
+    return lock.releaseWriteAndReturn(ret);
 }
 
 bool Filesystem::createDirectory(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireWrite();
 
     auto *driver = getMountedDriver(parsedPath);
     if (driver == nullptr) {
-        return lock.releaseAndReturn(false);
+        return lock.releaseWriteAndReturn(false);
     }
 
     bool ret = driver->createNode(parsedPath, Util::Io::File::DIRECTORY);
-    return lock.releaseAndReturn(ret);
+    return lock.releaseWriteAndReturn(ret);
 }
 
 bool Filesystem::deleteFile(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
-    lock.acquire();
+    lock.acquireWrite();
 
     for (const Util::String &key : mountPoints.getKeys()) {
         if (key.beginsWith(parsedPath)) {
-            lock.release();
+            lock.releaseWrite();
             return false;
         }
     }
 
     auto *driver = getMountedDriver(parsedPath);
     if (driver == nullptr) {
-        return lock.releaseAndReturn(false);
+        return lock.releaseWriteAndReturn(false);
     }
 
     bool ret = driver->deleteNode(parsedPath);
-    return lock.releaseAndReturn<bool>(ret);
+    return lock.releaseWriteAndReturn<bool>(ret);
 }
 
 Driver* Filesystem::getMountedDriver(Util::String &path) {
@@ -208,9 +210,6 @@ Driver* Filesystem::getMountedDriver(Util::String &path) {
         path += '/';
     }
 
-
-    lock.acquire();
-
     Util::String ret;
     for (const Util::String &currentString: mountPoints.getKeys()) {
         if (path.beginsWith(currentString)) {
@@ -221,16 +220,16 @@ Driver* Filesystem::getMountedDriver(Util::String &path) {
     }
 
     if (ret.isEmpty()) {
-        return lock.releaseAndReturn(nullptr);
+        return nullptr;
     }
 
     path = path.substring(ret.length(), path.length() - 1);
-    return lock.releaseAndReturn(mountPoints.get(ret));
+    return mountPoints.get(ret);
 }
 
 Util::Array<MountInformation> Filesystem::getMountInformation() {
-    lock.acquire();
-    return lock.releaseAndReturn(mountInformation.getValues());
+    lock.acquireRead();
+    return lock.releaseReadAndReturn(mountInformation.getValues());
 }
 
 bool MountInformation::operator!=(const MountInformation &other) const {
@@ -21,7 +21,7 @@
 #ifndef HHUOS_FILESYSTEM_H
 #define HHUOS_FILESYSTEM_H
 
-#include "lib/util/async/ReentrantSpinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 #include "lib/util/collection/HashMap.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/base/String.h"
@@ -170,8 +170,19 @@ public:
     Util::Array<MountInformation> getMountInformation();
     
 private:
+    /**
+     * Get a node at a specified path, while the lock is already held (for reading or writing).
+     * CAUTION: May return nullptr, if the file does not exist.
+     *
+     * @param path The path
+     *
+     * @return The node (or nullptr on failure)
+     */
+    Node* getNodeLocked(const Util::String &path);
+
     /**
      * Get the driver, that is mounted at a specified path.
+     * The lock must already be held (for reading or writing).
      * The path needs to be absolute.
      * CAUTION: May return nullptr, if the file does not exist.
      *          Always check the return value!
@@ -185,7 +196,7 @@ private:
 
     Util::HashMap<Util::String, Driver*> mountPoints;
     Util::HashMap<Util::String, MountInformation> mountInformation;
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReadWriteLock lock;
 };
 
 }
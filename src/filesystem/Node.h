@@ -21,6 +21,7 @@
 #ifndef HHUOS_NODE_H
 #define HHUOS_NODE_H
 
+#include "lib/util/base/ObjectCache.h"
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
 
@@ -55,6 +56,18 @@ public:
      */
     virtual ~Node() = default;
 
+    /**
+     * Nodes are created and deleted on every file access, so they are allocated from the general purpose object caches.
+     * The sized delete operator receives the size of the actual node type, since the destructor is virtual.
+     */
+    static void* operator new(size_t size) {
+        return Util::ObjectCache::allocateSized(size);
+    }
+
+    static void operator delete(void *pointer, size_t size) {
+        Util::ObjectCache::freeSized(pointer, size);
+    }
+
     /**
      * Get the name.
      */
@@ -102,6 +115,104 @@ public:
      */
     virtual uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t length) = 0;
 
+    /**
+     * Read bytes from the node's data into multiple buffers, each with its own offset.
+     * The vectors are processed in order and reading stops at the first vector, that could not be filled completely.
+     * The default implementation calls readData() for each vector. Nodes, that can serve several segments
+     * more efficiently at once (e.g. by reading from the underlying device only once), may override it.
+     *
+     * @param vectors The buffers, offsets and lengths to read
+     * @param count The amount of vectors
+     *
+     * @return The amount of actually read bytes over all vectors
+     */
+    virtual uint64_t readDataVector(const Util::Io::File::IoVector *vectors, size_t count) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; i++) {
+            const auto &vector = vectors[i];
+            const auto read = readData(static_cast<uint8_t*>(vector.buffer), vector.position, vector.length);
+            total += read;
+
+            if (read < vector.length) {
+                break;
+            }
+        }
+
+        return total;
+    }
+
+    /**
+     * Write bytes from multiple buffers to the node's data, each with its own offset.
+     * The vectors are processed in order and writing stops at the first vector, that could not be written completely.
+     * The default implementation calls writeData() for each vector.
+     *
+     * @param vectors The buffers, offsets and lengths to write
+     * @param count The amount of vectors
+     *
+     * @return The amount of actually written bytes over all vectors
+     */
+    virtual uint64_t writeDataVector(const Util::Io::File::IoVector *vectors, size_t count) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; i++) {
+            const auto &vector = vectors[i];
+            const auto written = writeData(static_cast<const uint8_t*>(vector.buffer), vector.position, vector.length);
+            total += written;
+
+            if (written < vector.length) {
+                break;
+            }
+        }
+
+        return total;
+    }
+
+    /**
+     * Copy bytes from this node's data to another node, without passing them through user space.
+     * The default implementation moves the data in chunks of COPY_CHUNK_SIZE bytes through a kernel buffer,
+     * using readData() and writeData(). Nodes, that can access their data directly (e.g. memory files)
+     * or share their storage with the target node (e.g. files on the same FAT volume), may override it.
+     * Copying stops early, if less bytes than requested could be read or written.
+     *
+     * @param target The node to write to
+     * @param sourcePos The offset in this node's data
+     * @param targetPos The offset in the target node's data
+     * @param length The amount of bytes to copy
+     *
+     * @return The amount of actually copied bytes
+     */
+    virtual uint64_t copyData(Node &target, uint64_t sourcePos, uint64_t targetPos, uint64_t length) {
+        auto *buffer = new uint8_t[COPY_CHUNK_SIZE];
+        uint64_t copied = 0;
+
+        while (copied < length) {
+            const auto chunkSize = length - copied > COPY_CHUNK_SIZE ? COPY_CHUNK_SIZE : length - copied;
+            const auto read = readData(buffer, sourcePos + copied, chunkSize);
+            if (read == 0) {
+                break;
+            }
+
+            const auto written = target.writeData(buffer, targetPos + copied, read);
+            copied += written;
+
+            if (written < read || read < chunkSize) {
+                break;
+            }
+        }
+
+        delete[] buffer;
+        return copied;
+    }
+
+    /**
+     * Get an identifier for the storage backing this node's data.
+     * Nodes, that share the same storage (e.g. files on the same FAT volume), return the same identifier.
+     * This allows copyData() implementations to detect, whether they can access the target node's storage directly.
+     * The default implementation returns nullptr, which never matches any other node.
+     */
+    virtual const void* getStorageIdentifier() {
+        return nullptr;
+    }
+
     /**
      * Check if this node is readable without blocking. Regular files are always ready to read.
      * This function is mainly useful for character files (i.e. streams), such as terminals or sockets.
@@ -131,6 +242,8 @@ public:
     virtual bool control([[maybe_unused]] uint32_t request, [[maybe_unused]] const Util::Array<uint32_t> &parameters) {
         return false;
     }
+
+    static const constexpr uint32_t COPY_CHUNK_SIZE = 64 * 1024;
 };
 
 }
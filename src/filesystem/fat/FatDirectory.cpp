@@ -27,7 +27,7 @@
 
 namespace Filesystem::Fat {
 
-FatDirectory::FatDirectory(const DIR &dir, const Util::String &path, Util::Async::Spinlock &fatLock) : FatNode(path, fatLock), directory(dir) {}
+FatDirectory::FatDirectory(const DIR &dir, const Util::String &path, Util::Async::Mutex &fatLock) : FatNode(path, fatLock), directory(dir) {}
 
 Util::Io::File::Type FatDirectory::getType() {
     return Util::Io::File::DIRECTORY;
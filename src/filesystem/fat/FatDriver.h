@@ -28,7 +28,7 @@
 #include "lib/util/base/String.h"
 #include "lib/util/reflection/Prototype.h"
 #include "lib/util/io/file/File.h"
-#include "util/async/Spinlock.h"
+#include "util/async/Mutex.h"
 
 namespace Device {
 namespace Storage {
@@ -105,7 +105,7 @@ private:
 
     uint32_t volumeId{};
     FATFS fatVolume{};
-    Util::Async::Spinlock lock;
+    Util::Async::Mutex lock;
 
     static Util::Async::AtomicBitmap volumeIdAllocator;
     static Util::Array<Device::Storage::StorageDevice*> deviceMap;
@@ -26,7 +26,7 @@
 
 namespace Filesystem::Fat {
 
-FatFile::FatFile(const FIL &file, const Util::String &path, Util::Async::Spinlock &fatLock) : FatNode(path, fatLock), file(file) {}
+FatFile::FatFile(const FIL &file, const Util::String &path, Util::Async::Mutex &fatLock) : FatNode(path, fatLock), file(file) {}
 
 Util::Io::File::Type FatFile::getType() {
     return Util::Io::File::REGULAR;
@@ -71,4 +71,40 @@ uint64_t FatFile::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t
         return fatLock.releaseAndReturn(writtenBytes);
 }
 
+uint64_t FatFile::copyData(Node &target, uint64_t sourcePos, uint64_t targetPos, uint64_t numBytes) {
+    if (target.getStorageIdentifier() != getStorageIdentifier() || target.getType() != Util::Io::File::REGULAR) {
+        return Node::copyData(target, sourcePos, targetPos, numBytes);
+    }
+
+    auto &targetFile = static_cast<FatFile&>(target);
+    auto *buffer = new uint8_t[COPY_CHUNK_SIZE];
+    uint64_t copied = 0;
+
+    fatLock.acquire();
+    while (copied < numBytes) {
+        const auto chunkSize = static_cast<uint32_t>(numBytes - copied > COPY_CHUNK_SIZE ? COPY_CHUNK_SIZE : numBytes - copied);
+
+        uint32_t readBytes;
+        if (f_lseek(&file, sourcePos + copied) != FR_OK || f_read(&file, buffer, chunkSize, &readBytes) != FR_OK || readBytes == 0) {
+            break;
+        }
+
+        uint32_t writtenBytes;
+        if (f_lseek(&targetFile.file, targetPos + copied) != FR_OK || f_write(&targetFile.file, buffer, readBytes, &writtenBytes) != FR_OK) {
+            break;
+        }
+
+        copied += writtenBytes;
+        if (writtenBytes < readBytes || readBytes < chunkSize) {
+            break;
+        }
+    }
+
+    f_sync(&targetFile.file);
+    fatLock.release();
+
+    delete[] buffer;
+    return copied;
+}
+
 }
\ No newline at end of file
@@ -35,7 +35,7 @@ public:
     /**
      * Constructor.
      */
-    FatFile(const FIL &file, const Util::String &path, Util::Async::Spinlock &lock);
+    FatFile(const FIL &file, const Util::String &path, Util::Async::Mutex &lock);
 
     /**
      * Copy Constructor.
@@ -72,6 +72,13 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    /**
+     * Overriding function from Node.
+     * If the target is a file on the same volume, the volume lock is held for the whole copy
+     * and the target file is only synchronized once at the end, instead of after every chunk.
+     */
+    uint64_t copyData(Node &target, uint64_t sourcePos, uint64_t targetPos, uint64_t numBytes) override;
+
 private:
 
     FIL file;
@@ -25,9 +25,9 @@
 
 namespace Filesystem::Fat {
 
-FatNode::FatNode(const Util::String &path, Util::Async::Spinlock &fatLock) : fatLock(fatLock), path(path) {}
+FatNode::FatNode(const Util::String &path, Util::Async::Mutex &fatLock) : fatLock(fatLock), path(path) {}
 
-FatNode *FatNode::open(const Util::String &path, Util::Async::Spinlock &fatLock) {
+FatNode *FatNode::open(const Util::String &path, Util::Async::Mutex &fatLock) {
     // Try to stat the file. If this fails, the file is either non-existent,
     // or it may be the root-directory (f_stat will fail, when executed on the root-directory).
     FILINFO info{};
@@ -73,6 +73,10 @@ uint64_t FatNode::getLength() {
     return info.fsize;
 }
 
+const void* FatNode::getStorageIdentifier() {
+    return &fatLock;
+}
+
 FILINFO FatNode::stat() {
     FILINFO info{};
     fatLock.acquire();
@@ -26,7 +26,7 @@
 #include "filesystem/fat/ff/source/ff.h"
 #include "filesystem/Node.h"
 #include "lib/util/base/String.h"
-#include "util/async/Spinlock.h"
+#include "util/async/Mutex.h"
 
 namespace Filesystem::Fat {
 
@@ -48,7 +48,7 @@ public:
      */
     ~FatNode() override = default;
 
-    static FatNode* open(const Util::String &path, Util::Async::Spinlock &fatLock);
+    static FatNode* open(const Util::String &path, Util::Async::Mutex &fatLock);
 
     /**
      * Overriding function from Node.
@@ -60,13 +60,19 @@ public:
      */
     uint64_t getLength() override;
 
+    /**
+     * Overriding function from Node.
+     * All nodes on the same FAT volume share the volume's lock, so its address identifies the volume.
+     */
+    const void* getStorageIdentifier() override;
+
 protected:
     /**
      * Constructor.
      */
-    explicit FatNode(const Util::String &path, Util::Async::Spinlock &fatLock);
+    explicit FatNode(const Util::String &path, Util::Async::Mutex &fatLock);
 
-    Util::Async::Spinlock &fatLock;
+    Util::Async::Mutex &fatLock;
 
 private:
 
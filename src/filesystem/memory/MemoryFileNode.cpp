@@ -58,18 +58,23 @@ uint64_t MemoryFileNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t
 uint64_t MemoryFileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
     auto sourceAddress = Util::Address(sourceBuffer);
 
-    if (pos + numBytes >= length) {
-        auto newLength = pos + numBytes;
-        auto *newData = new uint8_t[newLength];
+    if (pos + numBytes > capacity) {
+        // Grow the buffer exponentially, so that files written in many small chunks are not copied on every write
+        auto newCapacity = capacity * 2 > pos + numBytes ? capacity * 2 : pos + numBytes;
+        auto *newData = new uint8_t[newCapacity];
         auto oldAddress = Util::Address(data);
         auto newAddress = Util::Address(newData);
 
-        newAddress.setRange(0, newLength);
+        newAddress.setRange(0, newCapacity);
         newAddress.copyRange(oldAddress, length);
 
         delete data;
         data = newData;
-        length = newLength;
+        capacity = newCapacity;
+    }
+
+    if (pos + numBytes > length) {
+        length = pos + numBytes;
     }
 
     auto targetAddress = Util::Address(data).add(pos);
@@ -78,4 +83,25 @@ uint64_t MemoryFileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, ui
     return numBytes;
 }
 
+uint64_t MemoryFileNode::copyData(Node &target, uint64_t sourcePos, uint64_t targetPos, uint64_t numBytes) {
+    if (target.getStorageIdentifier() == this) {
+        // Writing to this node may reallocate its buffer, so it cannot be used as source directly
+        return Node::copyData(target, sourcePos, targetPos, numBytes);
+    }
+
+    if (sourcePos >= length) {
+        return 0;
+    }
+
+    if (sourcePos + numBytes > length) {
+        numBytes = (length - sourcePos);
+    }
+
+    return target.writeData(data + sourcePos, targetPos, numBytes);
+}
+
+const void* MemoryFileNode::getStorageIdentifier() {
+    return this;
+}
+
 }
\ No newline at end of file
@@ -77,9 +77,21 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    /**
+     * Overriding function from Node.
+     * The data is written to the target node directly from this node's buffer, without an intermediate copy.
+     */
+    uint64_t copyData(Node &target, uint64_t sourcePos, uint64_t targetPos, uint64_t numBytes) override;
+
+    /**
+     * Overriding function from Node.
+     */
+    const void* getStorageIdentifier() override;
+
 private:
 
     uint64_t length = 0;
+    uint64_t capacity = 0;
     uint8_t *data = nullptr;
 
 };
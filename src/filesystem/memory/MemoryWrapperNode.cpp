@@ -56,6 +56,14 @@ bool MemoryWrapperNode::control(uint32_t request, const Util::Array<uint32_t> &p
     return node.control(request, parameters);
 }
 
+uint64_t MemoryWrapperNode::copyData(Node &target, uint64_t sourcePos, uint64_t targetPos, uint64_t length) {
+    return node.copyData(target, sourcePos, targetPos, length);
+}
+
+const void* MemoryWrapperNode::getStorageIdentifier() {
+    return node.getStorageIdentifier();
+}
+
 bool MemoryWrapperNode::isReadyToRead() {
     return node.isReadyToRead();
 }
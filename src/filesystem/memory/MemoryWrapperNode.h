@@ -92,6 +92,16 @@ public:
      */
     bool control(uint32_t request, const Util::Array<uint32_t> &parameters) override;
 
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t copyData(Node &target, uint64_t sourcePos, uint64_t targetPos, uint64_t length) override;
+
+    /**
+     * Overriding function from Node.
+     */
+    const void* getStorageIdentifier() override;
+
     bool isReadyToRead() override;
 
 private:
@@ -29,6 +29,8 @@
 #include "ProcessFileNode.h"
 #include "SharedMemoryNode.h"
 #include "kernel/process/Process.h"
+#include "kernel/process/Thread.h"
+#include "kernel/memory/VirtualAddressSpace.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/io/file/File.h"
 #include "kernel/service/Service.h"
@@ -64,6 +66,17 @@ Node* ProcessDriver::getNode(const Util::String &path) {
             return new ProcessFileNode(name, process->getWorkingDirectory().getCanonicalPath());
         } else if (name == "thread_count") {
             return new ProcessFileNode(name, Util::String::format("%u", process->getThreadCount()));
+        } else if (name == "affinity") {
+            Util::String affinity;
+            for (const auto *thread : process->getThreads()) {
+                affinity += Util::String::format("%u %s 0x%08x\n", thread->getId(), static_cast<const char*>(thread->getName()), thread->getAffinity());
+            }
+
+            return new ProcessFileNode(name, affinity);
+        } else if (name == "page_faults") {
+            const auto &addressSpace = process->getAddressSpace();
+            return new ProcessFileNode(name, Util::String::format("Faults: %u\nMapped pages: %u\n",
+                addressSpace.getPageFaultCount(), addressSpace.getFaultMappedPageCount()));
         } else if (name == "pipes") {
             return new PipeDirectoryNode(id);
         } else if (name == "shared") {
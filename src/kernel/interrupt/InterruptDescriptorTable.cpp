@@ -361,8 +361,8 @@ void InterruptDescriptorTable::handleInterrupt(const InterruptFrame &frame, Inte
     interruptService.sendEndOfInterrupt(vector);
 }
 
-void InterruptDescriptorTable::handlePageFault([[maybe_unused]] InterruptFrame *frame, uint32_t errorCode) {
-    Service::getService<MemoryService>().handlePageFault(errorCode);
+void InterruptDescriptorTable::handlePageFault(InterruptFrame *frame, uint32_t errorCode) {
+    Service::getService<MemoryService>().handlePageFault(*frame, errorCode);
 }
 
 void InterruptDescriptorTable::handleFpuException([[maybe_unused]] InterruptFrame *frame) {
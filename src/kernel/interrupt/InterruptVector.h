@@ -71,7 +71,9 @@ enum InterruptVector : uint8_t {
 
     SYSTEM_CALL = 0x86,
 
-    // Local APIC interrupts (247 - 254)
+    // Local APIC interrupts (246 - 254)
+    TLB_SHOOTDOWN = 0xf6, // IPI, that invalidates stale TLB entries after pages have been unmapped or write protected
+    WAKEUP = 0xf7, // IPI, that ends the halt of an idle CPU
     CMCI = 0xf8,
     APICTIMER = 0xf9,
     THERMAL = 0xfa,
@@ -0,0 +1,52 @@
+; Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+; Institute of Computer Science, Department Operating Systems
+; Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+; Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+; This project has been supported by several students.
+; A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+;
+; This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+; License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+; later version.
+;
+; This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+; warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+; details.
+;
+; You should have received a copy of the GNU General Public License
+; along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+; Entry point for system calls via SYSENTER. The caller passes its arguments in registers:
+;   eax: System call code and parameter count (code | paramCount << 8)
+;   ebx: Pointer to the variadic parameter list (va_list)
+;   ecx: User stack pointer, which is restored by SYSEXIT
+;   edx: User instruction pointer, where SYSEXIT continues
+; The result is returned in eax. All other registers are preserved (ebx, esi, edi and ebp are callee-saved).
+
+[GLOBAL sysenter_entry]
+[EXTERN dispatch_fast_system_call]
+
+[SECTION .text]
+[BITS 32]
+
+sysenter_entry:
+    ; SYSENTER sets esp to the esp0 field of this CPU's task state segment,
+    ; which points to the kernel stack of the current thread (interrupts are disabled until it is loaded)
+    mov esp,[esp]
+    sti
+
+    ; Save user stack and instruction pointer for SYSEXIT
+    push ecx
+    push edx
+
+    ; Call dispatch_fast_system_call(codeAndParamCount, arguments)
+    push ebx
+    push eax
+    call dispatch_fast_system_call
+    add esp,8
+    movzx eax,al
+
+    ; Return to user space (SYSEXIT does not change the interrupt flag, so interrupts stay enabled)
+    pop edx
+    pop ecx
+    sysexit
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BuddyAllocator.h"
+
+#include "device/cpu/Cpu.h"
+#include "lib/util/base/Panic.h"
+
+namespace Kernel {
+
+BuddyAllocator::BuddyAllocator(uint8_t *startAddress, uint32_t maxOrderBlockCount) :
+        startAddress(startAddress), frameCount(maxOrderBlockCount << MAX_ORDER) {
+    if (reinterpret_cast<uint32_t>(startAddress) % MAX_BLOCK_SIZE != 0) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "BuddyAllocator: Start address is not aligned to the maximum block size!");
+    }
+
+    if (frameCount >= MAX_FRAME_COUNT) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "BuddyAllocator: Too much memory!");
+    }
+
+    frames = new Frame[frameCount];
+    for (uint32_t i = 0; i < frameCount; i++) {
+        frames[i] = { NONE, NONE, 0, false };
+    }
+
+    for (auto &head : freeLists) {
+        head = NONE;
+    }
+
+    for (uint32_t i = 0; i < maxOrderBlockCount; i++) {
+        pushBlock(i << MAX_ORDER, MAX_ORDER);
+    }
+}
+
+BuddyAllocator::~BuddyAllocator() {
+    delete[] frames;
+}
+
+void* BuddyAllocator::allocateBlock(uint32_t frameCount) {
+    if (frameCount == 0 || frameCount > (1u << MAX_ORDER)) {
+        return nullptr;
+    }
+
+    auto order = getOrder(frameCount);
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    lock.acquire();
+
+    // Find the smallest free block, that is large enough
+    auto currentOrder = order;
+    while (currentOrder <= MAX_ORDER && freeLists[currentOrder] == NONE) {
+        currentOrder++;
+    }
+
+    if (currentOrder > MAX_ORDER) {
+        lock.release();
+        Device::Cpu::restoreInterrupts(flags);
+        return nullptr;
+    }
+
+    auto index = freeLists[currentOrder];
+    removeBlock(index, currentOrder);
+
+    // Split the block, until it has the requested order -> The upper halves become free blocks
+    while (currentOrder > order) {
+        currentOrder--;
+        pushBlock(index + (1 << currentOrder), currentOrder);
+    }
+
+    // Give back the frames behind the requested count
+    freeRange(index + frameCount, (1u << order) - frameCount);
+
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    return startAddress + index * Util::PAGESIZE;
+}
+
+bool BuddyAllocator::freeBlock(void *pointer, uint32_t frameCount) {
+    auto *address = static_cast<uint8_t*>(pointer);
+    if (address < startAddress || address >= startAddress + this->frameCount * Util::PAGESIZE) {
+        return false;
+    }
+
+    auto index = static_cast<uint32_t>(address - startAddress) / Util::PAGESIZE;
+    if (index + frameCount > this->frameCount) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "BuddyAllocator: Freeing frames outside of managed memory!");
+    }
+
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    lock.acquire();
+    freeRange(index, frameCount);
+    lock.release();
+    Device::Cpu::restoreInterrupts(flags);
+
+    return true;
+}
+
+uint32_t BuddyAllocator::getFreeBlockCount(uint8_t order) const {
+    return order > MAX_ORDER ? 0 : freeBlockCounts[order];
+}
+
+size_t BuddyAllocator::getTotalMemory() const {
+    return frameCount * Util::PAGESIZE;
+}
+
+size_t BuddyAllocator::getFreeMemory() const {
+    size_t freeFrames = 0;
+    for (uint8_t order = 0; order <= MAX_ORDER; order++) {
+        freeFrames += freeBlockCounts[order] << order;
+    }
+
+    return freeFrames * Util::PAGESIZE;
+}
+
+void* BuddyAllocator::getStartAddress() const {
+    return startAddress;
+}
+
+void* BuddyAllocator::getEndAddress() const {
+    return startAddress + frameCount * Util::PAGESIZE - 1;
+}
+
+void BuddyAllocator::pushBlock(uint16_t index, uint8_t order) {
+    auto &frame = frames[index];
+    frame.order = order;
+    frame.free = true;
+    frame.previous = NONE;
+    frame.next = freeLists[order];
+
+    if (frame.next != NONE) {
+        frames[frame.next].previous = index;
+    }
+
+    freeLists[order] = index;
+    freeBlockCounts[order]++;
+}
+
+void BuddyAllocator::removeBlock(uint16_t index, uint8_t order) {
+    auto &frame = frames[index];
+    if (frame.previous == NONE) {
+        freeLists[order] = frame.next;
+    } else {
+        frames[frame.previous].next = frame.next;
+    }
+
+    if (frame.next != NONE) {
+        frames[frame.next].previous = frame.previous;
+    }
+
+    frame.free = false;
+    frame.next = NONE;
+    frame.previous = NONE;
+    freeBlockCounts[order]--;
+}
+
+void BuddyAllocator::freeBlock(uint16_t index, uint8_t order) {
+    if (frames[index].free) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "BuddyAllocator: Block is already free!");
+    }
+
+    // Merge with the buddy, as long as it is a free block of the same order
+    while (order < MAX_ORDER) {
+        uint16_t buddy = index ^ (1 << order);
+        if (!frames[buddy].free || frames[buddy].order != order) {
+            break;
+        }
+
+        removeBlock(buddy, order);
+        index = index < buddy ? index : buddy;
+        order++;
+    }
+
+    pushBlock(index, order);
+}
+
+void BuddyAllocator::freeRange(uint32_t index, uint32_t count) {
+    // Split the range into the largest naturally aligned blocks
+    while (count > 0) {
+        uint8_t order = 0;
+        while (order < MAX_ORDER && index % (2u << order) == 0 && (2u << order) <= count) {
+            order++;
+        }
+
+        freeBlock(static_cast<uint16_t>(index), order);
+        index += 1 << order;
+        count -= 1 << order;
+    }
+}
+
+uint8_t BuddyAllocator::getOrder(uint32_t frameCount) {
+    uint8_t order = 0;
+    while ((1u << order) < frameCount) {
+        order++;
+    }
+
+    return order;
+}
+
+}
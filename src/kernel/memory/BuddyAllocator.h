@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BUDDYALLOCATOR_H
+#define HHUOS_BUDDYALLOCATOR_H
+
+#include <stdint.h>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/base/Constants.h"
+#include "lib/util/base/MemoryManager.h"
+
+namespace Kernel {
+
+/**
+ * Binary buddy allocator for physically contiguous page frames.
+ * It manages a contiguous range of physical memory, which has been reserved in the page frame allocator beforehand.
+ * Blocks of 2^order frames are kept in one free list per order. Allocating splits larger blocks
+ * and freeing merges a block with its buddy, as long as the buddy is free as well.
+ * The physical memory itself is not accessed (it is usually not mapped), so all bookkeeping happens in a frame table on the kernel heap.
+ */
+class BuddyAllocator : public Util::MemoryManager {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param startAddress Physical start address of the managed memory (must be aligned to MAX_BLOCK_SIZE)
+     * @param maxOrderBlockCount The amount of memory to manage, in blocks of MAX_BLOCK_SIZE bytes
+     */
+    BuddyAllocator(uint8_t *startAddress, uint32_t maxOrderBlockCount);
+
+    /**
+     * Copy Constructor.
+     */
+    BuddyAllocator(const BuddyAllocator &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BuddyAllocator &operator=(const BuddyAllocator &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BuddyAllocator() override;
+
+    /**
+     * Allocate physically contiguous page frames.
+     * The request is rounded up to the next power of two to find a block, but frames behind the requested count
+     * are given back immediately. The returned address is aligned to the rounded up size.
+     *
+     * @param frameCount The amount of frames to allocate (at most 2^MAX_ORDER)
+     * @return The physical start address, or nullptr if no sufficiently large block is free
+     */
+    void* allocateBlock(uint32_t frameCount);
+
+    /**
+     * Free page frames, that have been allocated by allocateBlock().
+     * An allocation may also be freed in parts (e.g. frame by frame, when a mapping is removed).
+     *
+     * @param pointer The physical start address
+     * @param frameCount The amount of frames to free
+     * @return false, if the address is not managed by this allocator
+     */
+    bool freeBlock(void *pointer, uint32_t frameCount);
+
+    /**
+     * Get the amount of free blocks of the given order.
+     */
+    [[nodiscard]] uint32_t getFreeBlockCount(uint8_t order) const;
+
+    [[nodiscard]] size_t getTotalMemory() const override;
+
+    [[nodiscard]] size_t getFreeMemory() const override;
+
+    [[nodiscard]] void* getStartAddress() const override;
+
+    [[nodiscard]] void* getEndAddress() const override;
+
+    static const constexpr uint8_t MAX_ORDER = 11;
+    static const constexpr uint32_t MAX_BLOCK_SIZE = (1 << MAX_ORDER) * Util::PAGESIZE;
+    static const constexpr uint32_t MAX_FRAME_COUNT = UINT16_MAX;
+
+private:
+
+    struct Frame {
+        uint16_t next;
+        uint16_t previous;
+        uint8_t order;
+        bool free; // Only set for the first frame of a free block
+    };
+
+    void pushBlock(uint16_t index, uint8_t order);
+
+    void removeBlock(uint16_t index, uint8_t order);
+
+    void freeBlock(uint16_t index, uint8_t order);
+
+    void freeRange(uint32_t index, uint32_t count);
+
+    static uint8_t getOrder(uint32_t frameCount);
+
+    uint8_t *startAddress;
+    uint32_t frameCount;
+    Frame *frames;
+
+    uint16_t freeLists[MAX_ORDER + 1]{};
+    uint32_t freeBlockCounts[MAX_ORDER + 1]{};
+
+    Util::Async::Spinlock lock;
+
+    static const constexpr uint16_t NONE = UINT16_MAX;
+};
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "FileMapping.h"
+
+#include "filesystem/Node.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/service/Service.h"
+#include "lib/util/async/Atomic.h"
+
+namespace Kernel {
+
+FileMapping::FileMapping(Filesystem::Node *node, const Util::String &path, uint64_t offset, uint32_t pageCount, bool readOnly) :
+        node(node), path(path), offset(offset), pageCount(pageCount), readOnly(readOnly), pageFrames(new void*[pageCount]) {
+    for (uint32_t i = 0; i < pageCount; i++) {
+        pageFrames[i] = nullptr;
+    }
+}
+
+FileMapping::~FileMapping() {
+    auto &memoryService = Service::getService<MemoryService>();
+    for (uint32_t i = 0; i < pageCount; i++) {
+        if (pageFrames[i] != nullptr) {
+            memoryService.freePhysicalMemory(pageFrames[i], 1);
+        }
+    }
+
+    delete[] pageFrames;
+    delete node;
+
+    if (source != nullptr) {
+        memoryService.releaseFileMapping(*source);
+    }
+}
+
+FileMapping* FileMapping::createPrivateCopy() {
+    acquire();
+
+    auto *copy = new FileMapping(nullptr, path, offset, pageCount, readOnly);
+    copy->source = this;
+
+    return copy;
+}
+
+bool FileMapping::matches(const Util::String &path, uint64_t offset, uint32_t pageCount, bool readOnly) const {
+    return FileMapping::path == path && FileMapping::offset == offset && FileMapping::pageCount == pageCount && FileMapping::readOnly == readOnly;
+}
+
+void* FileMapping::getPageFrame(uint32_t pageIndex) {
+    lock.acquire();
+    return lock.releaseAndReturn(pageFrames[pageIndex]);
+}
+
+void* FileMapping::setPageFrame(uint32_t pageIndex, void *physicalAddress) {
+    lock.acquire();
+    if (pageFrames[pageIndex] == nullptr) {
+        pageFrames[pageIndex] = physicalAddress;
+    }
+
+    return lock.releaseAndReturn(pageFrames[pageIndex]);
+}
+
+void FileMapping::readPage(uint32_t pageIndex, uint8_t *buffer) {
+    if (source != nullptr) {
+        source->readPage(pageIndex, buffer);
+        return;
+    }
+
+    node->readData(buffer, offset + static_cast<uint64_t>(pageIndex) * Util::PAGESIZE, Util::PAGESIZE);
+}
+
+void FileMapping::acquire() {
+    Util::Async::Atomic<uint32_t>(referenceCount).inc();
+}
+
+bool FileMapping::release() {
+    return Util::Async::Atomic<uint32_t>(referenceCount).fetchAndDec() == 1;
+}
+
+uint32_t FileMapping::getPageCount() const {
+    return pageCount;
+}
+
+bool FileMapping::isReadOnly() const {
+    return readOnly;
+}
+
+}
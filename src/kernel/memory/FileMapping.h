@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_FILEMAPPING_H
+#define HHUOS_FILEMAPPING_H
+
+#include <stdint.h>
+
+#include "lib/util/base/Constants.h"
+#include "lib/util/base/String.h"
+#include "lib/util/async/Spinlock.h"
+
+namespace Filesystem {
+class Node;
+}  // namespace Filesystem
+
+namespace Kernel {
+
+/**
+ * A range of a file, that is mapped into one or more address spaces.
+ * Pages are read from the file on their first access and kept in page frames owned by the mapping,
+ * until the last address space has unmapped it. Each address space holds an additional reference
+ * on every frame it has mapped, so that frames stay valid until both the mapping and all
+ * address spaces have released them.
+ * Read-only mappings of the same file range are shared between address spaces.
+ * Writable mappings are private to a single address space and changes are not written back to the file.
+ * When an address space is cloned, the new address space gets a private copy of each writable mapping.
+ */
+class FileMapping {
+
+public:
+    /**
+     * Constructor. The mapping takes ownership of the node.
+     */
+    FileMapping(Filesystem::Node *node, const Util::String &path, uint64_t offset, uint32_t pageCount, bool readOnly);
+
+    /**
+     * Copy Constructor.
+     */
+    FileMapping(const FileMapping &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    FileMapping &operator=(const FileMapping &other) = delete;
+
+    /**
+     * Destructor. Releases the mapping's references on all loaded page frames.
+     */
+    ~FileMapping();
+
+    /**
+     * Create a private copy of this mapping, which covers the same file range, but does not share any loaded pages.
+     * The copy keeps a reference to this mapping and reads missing pages through its node.
+     */
+    FileMapping* createPrivateCopy();
+
+    [[nodiscard]] bool matches(const Util::String &path, uint64_t offset, uint32_t pageCount, bool readOnly) const;
+
+    /**
+     * Get the page frame holding a page of the mapping.
+     *
+     * @return The physical address of the frame, or nullptr if the page has not been loaded yet
+     */
+    void* getPageFrame(uint32_t pageIndex);
+
+    /**
+     * Store the page frame for a page of the mapping, if no other thread has loaded the page in the meantime.
+     *
+     * @return The frame, that holds the page from now on (either the given frame or the one loaded by another thread)
+     */
+    void* setPageFrame(uint32_t pageIndex, void *physicalAddress);
+
+    /**
+     * Read a page of the file into a buffer of Util::PAGESIZE bytes.
+     * Bytes behind the end of the file are left untouched.
+     */
+    void readPage(uint32_t pageIndex, uint8_t *buffer);
+
+    void acquire();
+
+    /**
+     * Release a reference to the mapping.
+     *
+     * @return true, if this has been the last reference and the mapping can be deleted
+     */
+    bool release();
+
+    [[nodiscard]] uint32_t getPageCount() const;
+
+    [[nodiscard]] bool isReadOnly() const;
+
+private:
+
+    Filesystem::Node *node;
+    FileMapping *source = nullptr;
+    Util::String path;
+    uint64_t offset;
+    uint32_t pageCount;
+    bool readOnly;
+
+    void **pageFrames;
+    Util::Async::Spinlock lock;
+    uint32_t referenceCount = 1;
+};
+
+/**
+ * A file mapping placed at a range of virtual memory inside an address space.
+ */
+struct FileMappingRegion {
+    uint32_t startAddress;
+    uint32_t pageCount;
+    FileMapping *mapping;
+
+    [[nodiscard]] bool overlaps(uint32_t address, uint32_t count) const {
+        return address < startAddress + pageCount * Util::PAGESIZE && startAddress < address + count * Util::PAGESIZE;
+    }
+};
+
+}
+
+#endif
@@ -39,7 +39,21 @@ Util::String MemoryStatusNode::getString() {
     auto memoryStatus = Kernel::Service::getService<Kernel::MemoryService>().getMemoryStatus();
     return "Physical:      " + formatMemory(memoryStatus.freePhysicalMemory) + " / " + formatMemory(memoryStatus.totalPhysicalMemory) + "\n"
             + "Kernel:        " + formatMemory(memoryStatus.freeKernelHeapMemory) + " / " + formatMemory(memoryStatus.totalKernelHeapMemory) + "\n"
-            + "Paging Area:   " + formatMemory(memoryStatus.freePagingAreaMemory) + " / " + formatMemory(memoryStatus.totalPagingAreaMemory) + "\n";
+            + "Paging Area:   " + formatMemory(memoryStatus.freePagingAreaMemory) + " / " + formatMemory(memoryStatus.totalPagingAreaMemory) + "\n"
+            + "Contiguous:    " + formatMemory(memoryStatus.freeContiguousMemory) + " / " + formatMemory(memoryStatus.totalContiguousMemory) + "\n"
+            + "Free blocks:  " + formatFreeBlocks(memoryStatus) + "\n"
+            + "Zeroed:        " + formatMemory(memoryStatus.zeroedMemory) + "\n"
+            + "Large pages:   " + Util::String::format("%u", memoryStatus.largePages) + "\n";
+}
+
+Util::String MemoryStatusNode::formatFreeBlocks(const MemoryService::MemoryStatus &memoryStatus) {
+    // One entry per buddy order, labeled with the block size
+    Util::String ret;
+    for (uint8_t order = 0; order <= BuddyAllocator::MAX_ORDER; order++) {
+        ret += Util::String::format(" %uK:%u", (Util::PAGESIZE << order) / 1024, memoryStatus.freeContiguousBlocks[order]);
+    }
+
+    return ret;
 }
 
 }
\ No newline at end of file
@@ -25,6 +25,7 @@
 
 #include "filesystem/memory/StringNode.h"
 #include "lib/util/base/String.h"
+#include "kernel/service/MemoryService.h"
 
 namespace Kernel {
 
@@ -60,6 +61,8 @@ private:
 
     static Util::String formatMemory(uint32_t value);
 
+    static Util::String formatFreeBlocks(const MemoryService::MemoryStatus &memoryStatus);
+
     Util::String memoryStatusBuffer;
 
 };
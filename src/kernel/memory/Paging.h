@@ -37,6 +37,9 @@ public:
 
     static const constexpr uint32_t ENTRIES_PER_TABLE = 1024;
 
+    // Size of a page, that is mapped directly by a page directory entry (requires page size extensions)
+    static const constexpr uint32_t LARGE_PAGE_SIZE = 4 * 1024 * 1024;
+
     enum Flags : uint32_t {
         // System defined flags
         NONE = 0x00,
@@ -49,6 +52,10 @@ public:
         DIRTY = 0x40,
         HUGE_PAGE = 0x80,
         GLOBAL = 0x100,
+        // Software defined flags (bits 9-11 are ignored by the CPU)
+        COPY_ON_WRITE = 0x200,
+        // Memory types (write-through alone selects write-combining, if the page attribute table has been programmed)
+        WRITE_COMBINING = WRITE_THROUGH,
     };
 
     struct Entry {
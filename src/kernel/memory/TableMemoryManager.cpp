@@ -21,6 +21,7 @@
 #include "TableMemoryManager.h"
 #include "kernel/log/Log.h"
 #include "lib/util/base/BitmapMemoryManager.h"
+#include "lib/util/base/Address.h"
 
 namespace Kernel {
 
@@ -156,6 +157,23 @@ void TableMemoryManager::freeBlock(void *pointer) {
     allocationTableEntry.decrementUseCount();
 }
 
+uint16_t TableMemoryManager::getUseCount(void *address) {
+    if (address > endAddress) {
+        return 0;
+    }
+
+    const auto index = calculateIndex(static_cast<uint8_t*>(address));
+
+    auto *referenceTable = reinterpret_cast<ReferenceTableEntry*>(referenceTableArray[index.referenceTableArrayIndex]);
+    auto &referenceTableEntry = referenceTable[index.referenceTableIndex];
+    if (referenceTableEntry.getAddress() == 0) {
+        return 0;
+    }
+
+    auto *allocationTable = reinterpret_cast<AllocationTableEntry*>(referenceTableEntry.getAddress());
+    return allocationTable[index.allocationTableIndex].getUseCount();
+}
+
 void *TableMemoryManager::allocateBlockAfterAddress(void *address) {
     auto startIndex = calculateIndex(reinterpret_cast<uint8_t*>(address));
     auto endIndex = calculateIndex(endAddress);
@@ -200,6 +218,52 @@ void *TableMemoryManager::allocateBlockAfterAddress(void *address) {
     return nullptr;
 }
 
+void* TableMemoryManager::allocateContiguousBlocks(void *address, uint32_t blockCount, uint32_t alignment) {
+    const auto size = blockCount * blockSize;
+    const auto end = reinterpret_cast<uint32_t>(endAddress);
+    auto current = Util::Address(address).alignUp(alignment).get();
+
+    while (current >= reinterpret_cast<uint32_t>(startAddress) && current + size > current && current + size - 1 <= end) {
+        uint32_t i;
+        for (i = 0; i < blockCount; i++) {
+            if (!isBlockFree(reinterpret_cast<uint8_t*>(current + i * blockSize))) {
+                break;
+            }
+        }
+
+        if (i == blockCount) {
+            setMemory(reinterpret_cast<uint8_t*>(current), reinterpret_cast<uint8_t*>(current + size - 1), 1, false);
+            return reinterpret_cast<void*>(current);
+        }
+
+        // Continue behind the used block
+        auto next = Util::Address(current + (i + 1) * blockSize).alignUp(alignment).get();
+        if (next <= current) {
+            break;
+        }
+
+        current = next;
+    }
+
+    return nullptr;
+}
+
+bool TableMemoryManager::isBlockFree(uint8_t *address) const {
+    const auto index = calculateIndex(address);
+    auto &referenceTableEntry = referenceTableArray[index.referenceTableArrayIndex][index.referenceTableIndex];
+    if (!referenceTableEntry.isInstalled()) {
+        return false;
+    }
+
+    // Allocation tables are created on first use -> No table means that the whole range is free
+    if (referenceTableEntry.getAddress() == 0) {
+        return true;
+    }
+
+    auto &allocationTableEntry = reinterpret_cast<AllocationTableEntry*>(referenceTableEntry.getAddress())[index.allocationTableIndex];
+    return !allocationTableEntry.isReserved() && allocationTableEntry.getUseCount() == 0;
+}
+
 uint32_t TableMemoryManager::getTotalMemory() const {
     return endAddress - startAddress + 1;
 }
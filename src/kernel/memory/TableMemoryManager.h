@@ -64,8 +64,26 @@ public:
 
     void* allocateBlockAfterAddress(void *address);
 
+    /**
+     * Search for a range of free blocks after the given address and mark it as used.
+     * The range is not locked during the search, so this must only be called while no other thread allocates blocks (e.g. during boot).
+     *
+     * @param address The address to start searching at
+     * @param blockCount The amount of contiguous blocks
+     * @param alignment The alignment of the range's start address
+     * @return The start address of the range, or nullptr if no such range exists
+     */
+    void* allocateContiguousBlocks(void *address, uint32_t blockCount, uint32_t alignment);
+
     void freeBlock(void *pointer) override;
 
+    /**
+     * Get the number of users of an allocated block (e.g. the number of address spaces mapping a page frame).
+     *
+     * @return The use count, or 0 if the block is not managed by this memory manager
+     */
+    uint16_t getUseCount(void *address);
+
     uint32_t getTotalMemory() const override;
 
     uint32_t getBlockSize() const override;
@@ -211,6 +229,8 @@ private:
 
     TableIndex calculateIndex(uint8_t *address) const;
 
+    bool isBlockFree(uint8_t *address) const;
+
     uint32_t calculateAddress(const TableIndex &index) const;
 
 private:
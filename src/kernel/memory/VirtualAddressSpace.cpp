@@ -20,6 +20,8 @@
 
 #include "VirtualAddressSpace.h"
 
+#include "lib/util/async/Atomic.h"
+#include "lib/util/base/Address.h"
 #include "lib/util/base/Constants.h"
 #include "lib/util/base/System.h"
 #include "kernel/service/MemoryService.h"
@@ -57,6 +59,12 @@ VirtualAddressSpace::VirtualAddressSpace() : kernelAddressSpace(false), physical
 }
 
 VirtualAddressSpace::~VirtualAddressSpace() {
+    // The pages have already been unmapped, so only the references to the file mappings are left
+    for (auto *region : fileMappings) {
+        Service::getService<MemoryService>().releaseFileMapping(*region->mapping);
+        delete region;
+    }
+
     if (!kernelAddressSpace) {
         Service::getService<MemoryService>().freePageTable(physicalPageDirectory);
         delete virtualPageDirectory;
@@ -81,6 +89,11 @@ void* VirtualAddressSpace::getPhysicalAddress(void *virtualAddress) const {
         return nullptr;
     }
 
+    // Large pages are mapped directly by the page directory
+    if (((*virtualPageDirectory)[pageDirectoryIndex].getFlags() & Paging::HUGE_PAGE) != 0) {
+        return reinterpret_cast<void*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress() | (reinterpret_cast<uint32_t>(virtualAddress) & (Paging::LARGE_PAGE_SIZE - 1)));
+    }
+
     // Get corresponding page table
     auto &pageTable = *reinterpret_cast<Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
 
@@ -93,47 +106,133 @@ void* VirtualAddressSpace::getPhysicalAddress(void *virtualAddress) const {
     return reinterpret_cast<void*>(pageTable[pageTableIndex].getAddress() | (reinterpret_cast<uint32_t>(virtualAddress) & 0x00000fff));
 }
 
-void VirtualAddressSpace::map(const void *physicalAddress, const void *virtualAddress, uint16_t flags, bool abortIfLocked) {
+bool VirtualAddressSpace::map(const void *physicalAddress, const void *virtualAddress, uint16_t flags, bool abortIfLocked) {
+    // Get indices into page table and directory
+    uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+    uint32_t pageTableIndex = Paging::TABLE_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+
+    // Lock page directory
+    if (abortIfLocked) {
+        if (!pageDirectoryLock.tryAcquire()) {
+            return false;
+        }
+    } else {
+        pageDirectoryLock.acquire();
+    }
+
+    // Get corresponding page table
+    auto &pageTable = getOrCreatePageTable(pageDirectoryIndex, virtualAddress);
+
+    // Check if the requested page is already mapped
+    if (!pageTable[pageTableIndex].isUnused()) {
+        pageDirectoryLock.release();
+        Util::Panic::fire(Util::Panic::PAGING_ERROR, "PageDirectory: Requested page is already mapped!");
+    }
+
+    // Set entry in page table
+    pageTable[pageTableIndex].set(reinterpret_cast<uint32_t>(physicalAddress), getEntryFlags(virtualAddress, flags));
+    pageDirectoryLock.release();
+
+    return true;
+}
+
+int32_t VirtualAddressSpace::mapUnmappedPages(const void *virtualAddress, uint32_t pageCount, uint16_t flags, bool abortIfLocked) {
     // Get indices into page table and directory
     uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
     uint32_t pageTableIndex = Paging::TABLE_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
     auto &memoryService = Service::getService<MemoryService>();
 
+    if (pageTableIndex + pageCount > Paging::ENTRIES_PER_TABLE) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "PageDirectory: Range crosses page table boundary!");
+    }
+
     // Lock page directory
     if (abortIfLocked) {
         if (!pageDirectoryLock.tryAcquire()) {
-            return;
+            return -1;
         }
     } else {
         pageDirectoryLock.acquire();
     }
 
-    // Check if the requested page table is present and allocate a new one, if necessary
-    if ((*virtualPageDirectory)[pageDirectoryIndex].isUnused()) {
-        // Allocate a page for the table
-        void *virtualPageTable = memoryService.allocatePageTable();
-        void *physicalPageTable = getPhysicalAddress(virtualPageTable);
+    auto &pageTable = getOrCreatePageTable(pageDirectoryIndex, virtualAddress);
+    const auto userPages = reinterpret_cast<uint32_t>(virtualAddress) >= MemoryLayout::KERNEL_AREA.endAddress;
+    flags = getEntryFlags(virtualAddress, flags);
 
-        // Calculate page directory flags
-        auto pageDirectoryFlags = Paging::PRESENT | Paging::WRITABLE | (reinterpret_cast<uint32_t>(virtualAddress) >= Kernel::MemoryLayout::KERNEL_AREA.endAddress ? Paging::USER_ACCESSIBLE : Paging::NONE);
+    // Fill all unused entries of the range (pages may have been mapped by another thread in the meantime)
+    int32_t mappedPages = 0;
+    for (uint32_t i = 0; i < pageCount; i++) {
+        auto &entry = pageTable[pageTableIndex + i];
+        if (!entry.isUnused()) {
+            continue;
+        }
 
-        // Set page directory entry
-        (*virtualPageDirectory)[pageDirectoryIndex].set(reinterpret_cast<uint32_t>(virtualPageTable), pageDirectoryFlags);
-        (*physicalPageDirectory)[pageDirectoryIndex].set(reinterpret_cast<uint32_t>(physicalPageTable), pageDirectoryFlags);
+        // Clear the frame before mapping it, since other threads may access the page as soon as it is mapped
+        bool zeroed;
+        auto *physicalAddress = memoryService.allocatePageFrame(zeroed);
+        const auto cleared = zeroed || memoryService.clearPageFrame(physicalAddress);
+        if (!cleared && userPages) {
+            pageDirectoryLock.release();
+            Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "PageDirectory: No page clearing window reserved!");
+        }
+
+        entry.set(reinterpret_cast<uint32_t>(physicalAddress), flags);
+
+        if (!cleared) {
+            Util::Address(reinterpret_cast<uint32_t>(virtualAddress) + i * Util::PAGESIZE).setRange(0, Util::PAGESIZE);
+        }
+
+        mappedPages++;
     }
 
-    // Get corresponding page table
-    auto &pageTable = *reinterpret_cast<Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
+    pageDirectoryLock.release();
+    return mappedPages;
+}
 
-    // Check if the requested page is already mapped
+bool VirtualAddressSpace::mapIfUnmapped(const void *physicalAddress, const void *virtualAddress, uint16_t flags) {
+    // Get indices into page table and directory
+    uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+    uint32_t pageTableIndex = Paging::TABLE_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+
+    pageDirectoryLock.acquire();
+    auto &pageTable = getOrCreatePageTable(pageDirectoryIndex, virtualAddress);
+
+    // Another thread may have resolved a fault on the same page in the meantime
     if (!pageTable[pageTableIndex].isUnused()) {
         pageDirectoryLock.release();
-        Util::Panic::fire(Util::Panic::PAGING_ERROR, "PageDirectory: Requested page is already mapped!");
+        return false;
     }
 
-    // Set entry in page table
-    pageTable[pageTableIndex].set(reinterpret_cast<uint32_t>(physicalAddress), flags);
+    pageTable[pageTableIndex].set(reinterpret_cast<uint32_t>(physicalAddress), getEntryFlags(virtualAddress, flags));
     pageDirectoryLock.release();
+
+    return true;
+}
+
+bool VirtualAddressSpace::mapLargePage(const void *physicalAddress, const void *virtualAddress, uint16_t flags) {
+    if (reinterpret_cast<uint32_t>(physicalAddress) % Paging::LARGE_PAGE_SIZE != 0 || reinterpret_cast<uint32_t>(virtualAddress) % Paging::LARGE_PAGE_SIZE != 0) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "PageDirectory: Large page is not aligned!");
+    }
+
+    // Kernel page tables are shared by all address spaces, so they must not be replaced by a large page
+    if (reinterpret_cast<uint32_t>(virtualAddress) < MemoryLayout::KERNEL_END) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "PageDirectory: Large pages are not supported in the kernel area!");
+    }
+
+    uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+    pageDirectoryLock.acquire();
+
+    // Page tables are not freed, when their pages are unmapped, so a range that has been used before keeps its page table
+    if (!(*virtualPageDirectory)[pageDirectoryIndex].isUnused()) {
+        return pageDirectoryLock.releaseAndReturn(false);
+    }
+
+    // The virtual page directory holds the physical address as well, since there is no page table to point to
+    (*virtualPageDirectory)[pageDirectoryIndex].set(reinterpret_cast<uint32_t>(physicalAddress), flags | Paging::HUGE_PAGE);
+    (*physicalPageDirectory)[pageDirectoryIndex].set(reinterpret_cast<uint32_t>(physicalAddress), flags | Paging::HUGE_PAGE);
+    largePageCount++;
+
+    return pageDirectoryLock.releaseAndReturn(true);
 }
 
 void* VirtualAddressSpace::unmap(const void *virtualAddress) {
@@ -150,6 +249,24 @@ void* VirtualAddressSpace::unmap(const void *virtualAddress) {
         return nullptr;
     }
 
+    // Unmap large page as a whole
+    if (((*virtualPageDirectory)[pageDirectoryIndex].getFlags() & Paging::HUGE_PAGE) != 0) {
+        auto physicalAddress = (*virtualPageDirectory)[pageDirectoryIndex].getAddress() | (reinterpret_cast<uint32_t>(virtualAddress) & (Paging::LARGE_PAGE_SIZE - 1) & ~(Util::PAGESIZE - 1));
+        (*virtualPageDirectory)[pageDirectoryIndex].clear();
+        (*physicalPageDirectory)[pageDirectoryIndex].clear();
+        largePageCount--;
+
+        // A single 'invlpg' invalidates the whole large page
+        asm volatile (
+                "invlpg (%0)"
+                :
+                : "r"(virtualAddress)
+                );
+
+        pageDirectoryLock.release();
+        return reinterpret_cast<void*>(physicalAddress);
+    }
+
     // Get corresponding page table
     auto &pageTable = *reinterpret_cast<Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
 
@@ -185,6 +302,326 @@ void* VirtualAddressSpace::unmap(const void *virtualAddress) {
     return reinterpret_cast<void*>(physicalAddress);
 }
 
+void VirtualAddressSpace::cloneUserSpace(VirtualAddressSpace &target) {
+    auto &memoryService = Service::getService<MemoryService>();
+
+    // The file mapping list is needed to find pages of writable file mappings, so it is locked for the whole operation
+    fileMappingLock.acquire();
+    pageDirectoryLock.acquire();
+
+    for (uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(MemoryLayout::KERNEL_AREA.endAddress); pageDirectoryIndex < Paging::ENTRIES_PER_TABLE; pageDirectoryIndex++) {
+        if ((*virtualPageDirectory)[pageDirectoryIndex].isUnused()) {
+            continue;
+        }
+
+        // Large pages map device memory, which is not reference counted and always shared
+        if (((*virtualPageDirectory)[pageDirectoryIndex].getFlags() & Paging::HUGE_PAGE) != 0) {
+            (*target.virtualPageDirectory)[pageDirectoryIndex] = (*virtualPageDirectory)[pageDirectoryIndex];
+            (*target.physicalPageDirectory)[pageDirectoryIndex] = (*physicalPageDirectory)[pageDirectoryIndex];
+            target.largePageCount++;
+            continue;
+        }
+
+        auto &pageTable = *reinterpret_cast<Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
+        Paging::Table *targetPageTable = nullptr;
+
+        for (uint32_t pageTableIndex = 0; pageTableIndex < Paging::ENTRIES_PER_TABLE; pageTableIndex++) {
+            auto &entry = pageTable[pageTableIndex];
+            if (entry.isUnused()) {
+                continue;
+            }
+
+            // The time page is mapped into every user space on creation (see TimeService::mapTimePage())
+            const auto virtualAddress = pageDirectoryIndex * Paging::ENTRIES_PER_TABLE * Util::PAGESIZE + pageTableIndex * Util::PAGESIZE;
+            if (virtualAddress == Util::TIME_PAGE_ADDRESS || virtualAddress == Util::TIME_COUNTER_PAGE_ADDRESS) {
+                continue;
+            }
+
+            auto *physicalAddress = reinterpret_cast<void*>(entry.getAddress());
+            auto flags = entry.getFlags();
+            const auto useCount = memoryService.getPageFrameUseCount(physicalAddress);
+
+            if ((flags & (Paging::CACHE_DISABLE | Paging::WRITE_COMBINING)) != 0) {
+                // Uncached and write-combining memory is used for device I/O. Memory mapped registers (not managed by the page frame allocator)
+                // are shared, but buffers in physical memory belong to the devices used by this address space.
+                if (useCount > 0) {
+                    continue;
+                }
+            } else if ((flags & Paging::COPY_ON_WRITE) != 0 || ((flags & Paging::WRITABLE) != 0 && (useCount == 1 || isPrivateFileMappingPage(virtualAddress)))) {
+                // Pages of writable file mappings are also referenced by their mapping, but still private to this address space
+                flags = (flags & ~Paging::WRITABLE) | Paging::COPY_ON_WRITE;
+                entry.set(entry.getAddress(), flags);
+            }
+
+            if (targetPageTable == nullptr) {
+                const auto virtualAddress = reinterpret_cast<void*>(pageDirectoryIndex * Paging::ENTRIES_PER_TABLE * Util::PAGESIZE);
+                targetPageTable = &target.getOrCreatePageTable(pageDirectoryIndex, virtualAddress);
+            }
+
+            memoryService.referencePageFrame(physicalAddress);
+            (*targetPageTable)[pageTableIndex].set(entry.getAddress(), flags & ~(Paging::ACCESSED | Paging::DIRTY));
+        }
+    }
+
+    // Pages of this address space may have become read-only, so the TLB must not hold writable entries for them anymore
+    asm volatile (
+            "mov %%cr3, %%eax;"
+            "mov %%eax, %%cr3;"
+            : : :
+            "eax", "memory"
+            );
+
+    pageDirectoryLock.release();
+
+    // The file mappings keep resolving faults in the new address space.
+    // Read-only mappings are shared, while writable mappings are copied, so that both sides load missing pages into their own frames.
+    for (const auto *region : fileMappings) {
+        auto *mapping = region->mapping;
+        if (mapping->isReadOnly()) {
+            mapping->acquire();
+        } else {
+            mapping = mapping->createPrivateCopy();
+        }
+
+        target.addFileMapping(reinterpret_cast<void*>(region->startAddress), region->pageCount, *mapping);
+    }
+    fileMappingLock.release();
+
+    // Other threads of this process must not keep writing to the now shared frames through their TLBs (covers the whole user space, so the targets reload cr3)
+    memoryService.invalidateTlbEntries(*this, reinterpret_cast<void*>(MemoryLayout::KERNEL_AREA.endAddress), (MemoryLayout::MEMORY_END - MemoryLayout::KERNEL_AREA.endAddress + 1) / Util::PAGESIZE);
+}
+
+bool VirtualAddressSpace::isCopyOnWrite(const void *virtualAddress) const {
+    uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+    uint32_t pageTableIndex = Paging::TABLE_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+
+    const auto &directoryEntry = (*virtualPageDirectory)[pageDirectoryIndex];
+    if (directoryEntry.isUnused() || (directoryEntry.getFlags() & Paging::HUGE_PAGE) != 0) {
+        return false;
+    }
+
+    auto &pageTable = *reinterpret_cast<Paging::Table*>(directoryEntry.getAddress());
+    return !pageTable[pageTableIndex].isUnused() && (pageTable[pageTableIndex].getFlags() & Paging::COPY_ON_WRITE) != 0;
+}
+
+bool VirtualAddressSpace::isWritableUserRange(const void *virtualAddress, uint32_t length) {
+    const auto startAddress = reinterpret_cast<uint32_t>(virtualAddress);
+    if (length == 0) {
+        return true;
+    }
+
+    if (startAddress < MemoryLayout::KERNEL_AREA.endAddress || startAddress + (length - 1) < startAddress) {
+        return false;
+    }
+
+    const auto firstPage = Util::Address(startAddress).alignDown(Util::PAGESIZE).get();
+    const auto pageCount = (Util::Address(startAddress + (length - 1)).alignDown(Util::PAGESIZE).get() - firstPage) / Util::PAGESIZE + 1;
+    fileMappingLock.acquire();
+    pageDirectoryLock.acquire();
+
+    auto writable = true;
+    for (uint32_t i = 0; i < pageCount && writable; i++) {
+        const auto pageAddress = firstPage + i * Util::PAGESIZE;
+        const auto &directoryEntry = (*virtualPageDirectory)[Paging::DIRECTORY_INDEX(pageAddress)];
+        const auto *entry = directoryEntry.isUnused() || (directoryEntry.getFlags() & Paging::HUGE_PAGE) != 0 ? &directoryEntry :
+                &(*reinterpret_cast<Paging::Table*>(directoryEntry.getAddress()))[Paging::TABLE_INDEX(pageAddress)];
+
+        if (!entry->isUnused()) {
+            writable = (entry->getFlags() & (Paging::WRITABLE | Paging::COPY_ON_WRITE)) != 0;
+        } else {
+            // Pages of read-only file mappings are mapped read-only on the first access
+            for (const auto *region : fileMappings) {
+                if (region->mapping->isReadOnly() && region->overlaps(pageAddress, 1)) {
+                    writable = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    pageDirectoryLock.release();
+    fileMappingLock.release();
+
+    return writable;
+}
+
+bool VirtualAddressSpace::takeOverCopyOnWritePage(const void *virtualAddress, void *&physicalAddress) {
+    uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+    uint32_t pageTableIndex = Paging::TABLE_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+
+    pageDirectoryLock.acquire();
+
+    auto &pageTable = *reinterpret_cast<Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
+    auto &entry = pageTable[pageTableIndex];
+    if (entry.isUnused() || (entry.getFlags() & Paging::COPY_ON_WRITE) == 0) {
+        // Already resolved by another thread
+        return pageDirectoryLock.releaseAndReturn(true);
+    }
+
+    // The use count is checked while holding the lock, so that the page cannot be shared again in the meantime
+    physicalAddress = reinterpret_cast<void*>(entry.getAddress());
+    if (Service::getService<MemoryService>().getPageFrameUseCount(physicalAddress) > 1) {
+        return pageDirectoryLock.releaseAndReturn(false);
+    }
+
+    entry.set(entry.getAddress(), (entry.getFlags() & ~Paging::COPY_ON_WRITE) | Paging::WRITABLE);
+    asm volatile (
+            "invlpg (%0)"
+            :
+            : "r"(virtualAddress)
+            );
+
+    return pageDirectoryLock.releaseAndReturn(true);
+}
+
+bool VirtualAddressSpace::replaceCopyOnWritePage(const void *virtualAddress, const void *oldPhysicalAddress, const void *newPhysicalAddress) {
+    uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+    uint32_t pageTableIndex = Paging::TABLE_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+
+    pageDirectoryLock.acquire();
+
+    auto &pageTable = *reinterpret_cast<Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
+    auto &entry = pageTable[pageTableIndex];
+    if (entry.isUnused() || (entry.getFlags() & Paging::COPY_ON_WRITE) == 0 || entry.getAddress() != reinterpret_cast<uint32_t>(oldPhysicalAddress)) {
+        return pageDirectoryLock.releaseAndReturn(false);
+    }
+
+    entry.set(reinterpret_cast<uint32_t>(newPhysicalAddress), (entry.getFlags() & ~Paging::COPY_ON_WRITE) | Paging::WRITABLE);
+    asm volatile (
+            "invlpg (%0)"
+            :
+            : "r"(virtualAddress)
+            );
+
+    return pageDirectoryLock.releaseAndReturn(true);
+}
+
+void VirtualAddressSpace::addFileMapping(const void *virtualAddress, uint32_t pageCount, FileMapping &mapping) {
+    auto *region = new FileMappingRegion{reinterpret_cast<uint32_t>(virtualAddress), pageCount, &mapping};
+
+    fileMappingLock.acquire();
+    fileMappings.add(region);
+    fileMappingLock.release();
+}
+
+bool VirtualAddressSpace::removeFileMapping(const void *virtualAddress, FileMappingRegion &region) {
+    fileMappingLock.acquire();
+
+    for (uint32_t i = 0; i < fileMappings.size(); i++) {
+        if (fileMappings.get(i)->startAddress == reinterpret_cast<uint32_t>(virtualAddress)) {
+            auto *removedRegion = fileMappings.removeIndex(i);
+            fileMappingLock.release();
+
+            region = *removedRegion;
+            delete removedRegion;
+            return true;
+        }
+    }
+
+    return fileMappingLock.releaseAndReturn(false);
+}
+
+bool VirtualAddressSpace::findFileMapping(const void *virtualAddress, uint32_t pageCount, const void *faultAddress, FileMappingRegion &region, bool &locked) {
+    locked = !fileMappingLock.tryAcquire();
+    if (locked) {
+        return false;
+    }
+
+    // A region containing the faulted page takes precedence over regions, that only overlap the window
+    const FileMappingRegion *overlappingRegion = nullptr;
+    for (const auto *currentRegion : fileMappings) {
+        if (currentRegion->overlaps(reinterpret_cast<uint32_t>(faultAddress), 1)) {
+            region = *currentRegion;
+            region.mapping->acquire();
+            fileMappingLock.release();
+
+            return true;
+        }
+
+        if (currentRegion->overlaps(reinterpret_cast<uint32_t>(virtualAddress), pageCount)) {
+            overlappingRegion = currentRegion;
+        }
+    }
+
+    if (overlappingRegion != nullptr) {
+        region = *overlappingRegion;
+    }
+
+    return fileMappingLock.releaseAndReturn(overlappingRegion != nullptr);
+}
+
+bool VirtualAddressSpace::isPrivateFileMappingPage(uint32_t virtualAddress) const {
+    for (const auto *region : fileMappings) {
+        if (!region->mapping->isReadOnly() && region->overlaps(virtualAddress, 1)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void VirtualAddressSpace::countPageFault(uint32_t mappedPages) {
+    Util::Async::Atomic<uint32_t>(pageFaultCount).inc();
+    Util::Async::Atomic<uint32_t>(faultMappedPageCount).add(mappedPages);
+}
+
+uint32_t VirtualAddressSpace::getPageFaultCount() const {
+    return pageFaultCount;
+}
+
+uint32_t VirtualAddressSpace::getFaultMappedPageCount() const {
+    return faultMappedPageCount;
+}
+
+uint32_t VirtualAddressSpace::getLargePageCount() const {
+    return largePageCount;
+}
+
+bool VirtualAddressSpace::isLargePage(const void *virtualAddress) const {
+    const auto &directoryEntry = (*virtualPageDirectory)[Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress))];
+    return !directoryEntry.isUnused() && (directoryEntry.getFlags() & Paging::HUGE_PAGE) != 0;
+}
+
+Paging::Table& VirtualAddressSpace::getOrCreatePageTable(uint32_t pageDirectoryIndex, const void *virtualAddress) {
+    auto &memoryService = Service::getService<MemoryService>();
+
+    // Check if the requested page table is present and allocate a new one, if necessary
+    if ((*virtualPageDirectory)[pageDirectoryIndex].isUnused()) {
+        // Allocate a page for the table
+        void *virtualPageTable = memoryService.allocatePageTable();
+        void *physicalPageTable = getPhysicalAddress(virtualPageTable);
+
+        // Calculate page directory flags
+        auto pageDirectoryFlags = Paging::PRESENT | Paging::WRITABLE | (reinterpret_cast<uint32_t>(virtualAddress) >= Kernel::MemoryLayout::KERNEL_AREA.endAddress ? Paging::USER_ACCESSIBLE : Paging::NONE);
+
+        // Set page directory entry
+        (*virtualPageDirectory)[pageDirectoryIndex].set(reinterpret_cast<uint32_t>(virtualPageTable), pageDirectoryFlags);
+        (*physicalPageDirectory)[pageDirectoryIndex].set(reinterpret_cast<uint32_t>(physicalPageTable), pageDirectoryFlags);
+    }
+
+    if (((*virtualPageDirectory)[pageDirectoryIndex].getFlags() & Paging::HUGE_PAGE) != 0) {
+        Util::Panic::fire(Util::Panic::PAGING_ERROR, "PageDirectory: Requested page is part of a large page!");
+    }
+
+    // Get corresponding page table
+    return *reinterpret_cast<Paging::Table*>((*virtualPageDirectory)[pageDirectoryIndex].getAddress());
+}
+
+Paging::Entry& VirtualAddressSpace::getPageTableEntry(const void *virtualAddress) {
+    uint32_t pageDirectoryIndex = Paging::DIRECTORY_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+    uint32_t pageTableIndex = Paging::TABLE_INDEX(reinterpret_cast<uint32_t>(virtualAddress));
+
+    pageDirectoryLock.acquire();
+    auto &entry = getOrCreatePageTable(pageDirectoryIndex, virtualAddress)[pageTableIndex];
+    pageDirectoryLock.release();
+
+    return entry;
+}
+
+uint16_t VirtualAddressSpace::getEntryFlags(const void *virtualAddress, uint16_t flags) {
+    return reinterpret_cast<uint32_t>(virtualAddress) < MemoryLayout::KERNEL_END ? flags | Paging::GLOBAL : flags;
+}
+
 const Paging::Table& VirtualAddressSpace::getPageDirectoryPhysical() const {
     return *physicalPageDirectory;
 }
@@ -25,6 +25,8 @@
 #include <lib/util/async/Spinlock.h>
 
 #include "Paging.h"
+#include "FileMapping.h"
+#include "lib/util/collection/ArrayList.h"
 
 namespace Util {
 
@@ -72,10 +74,125 @@ public:
 
     void* getPhysicalAddress(void *virtualAddress) const;
 
-    void map(const void *physicalAddress, const void *virtualAddress, uint16_t flags, bool abortIfLocked = false);
+    /**
+     * Map a physical page frame to a virtual address.
+     *
+     * @return false, if 'abortIfLocked' is set and the page directory is locked, true otherwise
+     */
+    bool map(const void *physicalAddress, const void *virtualAddress, uint16_t flags, bool abortIfLocked = false);
+
+    /**
+     * Map page frames to all unmapped pages in a range of virtual memory, using a single page table lookup.
+     * The range must not cross the boundary of a page table. Frames are taken from the memory service's pool of
+     * zeroed frames. Frames, that are not zeroed yet, are cleared through a kernel window before they are mapped,
+     * so that no other thread can observe their old content. Until the windows have been reserved,
+     * kernel pages are cleared through their new mapping instead, so this must be the current address space.
+     *
+     * @return The number of mapped pages, or -1 if 'abortIfLocked' is set and the page directory is locked
+     */
+    int32_t mapUnmappedPages(const void *virtualAddress, uint32_t pageCount, uint16_t flags, bool abortIfLocked = false);
+
+    /**
+     * Map a physical page frame to a virtual address, if no frame is mapped there yet.
+     *
+     * @return false, if the page was already mapped
+     */
+    bool mapIfUnmapped(const void *physicalAddress, const void *virtualAddress, uint16_t flags);
+
+    /**
+     * Map a 4 MiB page directly via the page directory (requires page size extensions to be enabled).
+     * Both addresses must be aligned to the large page size and no page table may exist for the virtual address yet.
+     * Large pages are not reference counted and meant for memory outside the page frame allocator (e.g. frame buffers).
+     *
+     * @return false, if the virtual address is already covered by a page table or another large page
+     */
+    bool mapLargePage(const void *physicalAddress, const void *virtualAddress, uint16_t flags);
 
+    /**
+     * Unmap a page. If the page is part of a large page, the whole large page is unmapped.
+     *
+     * @return The physical address of the unmapped page, or nullptr if it was not mapped
+     */
     void* unmap(const void *virtualAddress);
 
+    bool isLargePage(const void *virtualAddress) const;
+
+    /**
+     * Get the page table entry of a virtual address, creating the page table if necessary.
+     * The reference is only valid, as long as the page table is not freed.
+     */
+    Paging::Entry& getPageTableEntry(const void *virtualAddress);
+
+    /**
+     * Share all user space pages of this address space with another, empty address space.
+     * Private writable pages are marked copy-on-write in both address spaces, so that they are only copied,
+     * when one side writes to them. Pages that are already shared on purpose (e.g. shared memory) stay shared.
+     * Writable file mappings are private as well, so the new address space gets its own copy of them.
+     * Only page tables are copied and every shared page frame gets an additional reference.
+     * This must be the current address space. Before returning, the TLBs of all CPUs running this address space are flushed,
+     * so that no thread can write to a copy-on-write page through a stale entry.
+     */
+    void cloneUserSpace(VirtualAddressSpace &target);
+
+    bool isCopyOnWrite(const void *virtualAddress) const;
+
+    /**
+     * Check if the kernel can write to a range of user space memory without causing a protection fault.
+     * Unmapped pages count as writable, since they are mapped on demand, unless they belong to a read-only file mapping.
+     * Used to validate buffers passed to system calls, because write protection also applies to the kernel.
+     */
+    bool isWritableUserRange(const void *virtualAddress, uint32_t length);
+
+    /**
+     * Try to resolve a write access to a copy-on-write page without copying it,
+     * which is possible if no other address space shares the page frame anymore.
+     *
+     * @param physicalAddress Set to the shared page frame, if the page needs to be copied
+     * @return true, if the page is writable now
+     */
+    bool takeOverCopyOnWritePage(const void *virtualAddress, void *&physicalAddress);
+
+    /**
+     * Replace the shared page frame of a copy-on-write page with a private copy and make the page writable.
+     *
+     * @return false, if the page has been resolved by another thread in the meantime
+     */
+    bool replaceCopyOnWritePage(const void *virtualAddress, const void *oldPhysicalAddress, const void *newPhysicalAddress);
+
+    /**
+     * Place a file mapping at a range of virtual memory. Page faults inside this range are resolved by the
+     * file mapping and the range is excluded from the fault-around window of anonymous memory.
+     */
+    void addFileMapping(const void *virtualAddress, uint32_t pageCount, FileMapping &mapping);
+
+    /**
+     * Remove the file mapping, that starts at the given virtual address.
+     * The caller takes over the address space's reference to the mapping.
+     *
+     * @return false, if no file mapping starts at the given address
+     */
+    bool removeFileMapping(const void *virtualAddress, FileMappingRegion &region);
+
+    /**
+     * Find a file mapping, that overlaps a range of pages. If the mapping contains the page at 'faultAddress',
+     * a reference to it is acquired, which must be released via MemoryService::releaseFileMapping().
+     * This is called by the page fault handler, so it does not wait, if the list of file mappings is locked.
+     *
+     * @return false, if no file mapping overlaps the range or the list is locked (in which case 'locked' is set)
+     */
+    bool findFileMapping(const void *virtualAddress, uint32_t pageCount, const void *faultAddress, FileMappingRegion &region, bool &locked);
+
+    /**
+     * Count a page fault in this address space and the number of pages mapped to resolve it.
+     */
+    void countPageFault(uint32_t mappedPages);
+
+    uint32_t getPageFaultCount() const;
+
+    uint32_t getFaultMappedPageCount() const;
+
+    uint32_t getLargePageCount() const;
+
     Util::HeapMemoryManager& getMemoryManager() const;
 
     const Paging::Table& getPageDirectoryPhysical() const;
@@ -84,11 +201,35 @@ public:
 
 private:
 
+    /**
+     * Get the page table for a page directory index and allocate it, if it is not present yet.
+     * The page directory lock must be held.
+     */
+    Paging::Table& getOrCreatePageTable(uint32_t pageDirectoryIndex, const void *virtualAddress);
+
+    /**
+     * Check if a page belongs to a writable file mapping. The file mapping lock must be held.
+     */
+    bool isPrivateFileMappingPage(uint32_t virtualAddress) const;
+
+    /**
+     * Mark entries in the kernel area as global, since it is shared by all address spaces.
+     * Global entries survive reloading cr3 (if page global enable is set) and are only flushed by 'invlpg' or by toggling page global enable.
+     */
+    static uint16_t getEntryFlags(const void *virtualAddress, uint16_t flags);
+
     bool kernelAddressSpace;
     Paging::Table *physicalPageDirectory;
     Paging::Table *virtualPageDirectory;
     Util::Async::Spinlock pageDirectoryLock;
     Util::HeapMemoryManager &memoryManager;
+
+    Util::ArrayList<FileMappingRegion*> fileMappings;
+    Util::Async::Spinlock fileMappingLock;
+
+    uint32_t pageFaultCount = 0;
+    uint32_t faultMappedPageCount = 0;
+    uint32_t largePageCount = 0;
 };
 
 }
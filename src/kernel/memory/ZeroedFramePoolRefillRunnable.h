@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_ZEROEDFRAMEPOOLREFILLRUNNABLE_H
+#define HHUOS_ZEROEDFRAMEPOOLREFILLRUNNABLE_H
+
+#include <stdint.h>
+
+#include "lib/util/async/Runnable.h"
+
+namespace Kernel {
+class MemoryService;
+
+/**
+ * Zeroes free page frames in the background and puts them into the memory service's zeroed frame pool,
+ * so that page faults can be served without clearing a frame synchronously.
+ */
+class ZeroedFramePoolRefillRunnable : public Util::Async::Runnable {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit ZeroedFramePoolRefillRunnable(MemoryService &memoryService);
+
+    /**
+     * Copy Constructor.
+     */
+    ZeroedFramePoolRefillRunnable(const ZeroedFramePoolRefillRunnable &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ZeroedFramePoolRefillRunnable &operator=(const ZeroedFramePoolRefillRunnable &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ZeroedFramePoolRefillRunnable() override = default;
+
+    void run() override;
+
+private:
+
+    MemoryService &memoryService;
+
+    static const constexpr uint32_t REFILL_INTERVAL_MS = 10;
+};
+
+}
+
+#endif
@@ -23,7 +23,6 @@
 
 #include "DatagramSocket.h"
 
-#include "lib/util/async/Thread.h"
 #include "lib/util/network/NetworkAddress.h"
 #include "kernel/network/Socket.h"
 #include "lib/util/time/Timestamp.h"
@@ -48,18 +47,23 @@ DatagramSocket::DatagramSocket(NetworkModule &networkModule, Util::Network::Sock
 
 Util::Network::Datagram *DatagramSocket::receive() {
     uint32_t startTime = Util::Time::Timestamp::getSystemTime().toMilliseconds();
+
+    lock.acquire();
     while (incomingDatagramQueue.isEmpty()) {
-        Util::Async::Thread::yield();
+        if (timeout == 0) {
+            receiveQueue.wait(lock);
+            continue;
+        }
 
-        if (timeout > 0) {
-            auto currentTime = Util::Time::Timestamp::getSystemTime().toMilliseconds();
-            if (currentTime - startTime >= timeout) {
-                return nullptr;
-            }
+        auto elapsedTime = static_cast<uint32_t>(Util::Time::Timestamp::getSystemTime().toMilliseconds()) - startTime;
+        if (elapsedTime >= timeout) {
+            lock.release();
+            return nullptr;
         }
+
+        receiveQueue.wait(lock, Util::Time::Timestamp::ofMilliseconds(timeout - elapsedTime));
     }
 
-    lock.acquire();
     auto *datagram = incomingDatagramQueue.poll();
     lock.release();
 
@@ -70,6 +74,8 @@ void DatagramSocket::handleIncomingDatagram(Util::Network::Datagram *datagram) {
     lock.acquire();
     incomingDatagramQueue.offer(datagram);
     lock.release();
+
+    receiveQueue.wake();
 }
 
 Util::String DatagramSocket::getName() {
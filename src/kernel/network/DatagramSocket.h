@@ -27,6 +27,7 @@
 #include <stdint.h>
 
 #include "Socket.h"
+#include "kernel/process/WaitQueue.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/collection/ArrayListQueue.h"
 #include "lib/util/io/file/File.h"
@@ -134,6 +135,7 @@ private:
 
     Util::Async::Spinlock lock;
     Util::ArrayListQueue<Util::Network::Datagram*> incomingDatagramQueue;
+    WaitQueue receiveQueue;
 };
 
 }
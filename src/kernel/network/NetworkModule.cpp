@@ -38,15 +38,15 @@ namespace Kernel::Network {
 class Socket;
 
 bool NetworkModule::registerSocket(Socket &socket) {
-    socketLock.acquire();
+    socketLock.acquireWrite();
     socketList.add(&socket);
-    return socketLock.releaseAndReturn(true);
+    return socketLock.releaseWriteAndReturn(true);
 }
 
 void NetworkModule::deregisterSocket(Socket &socket) {
-    socketLock.acquire();
+    socketLock.acquireWrite();
     socketList.remove(&socket);
-    socketLock.release();
+    socketLock.releaseWrite();
 }
 
 void NetworkModule::registerNextLayerModule(uint32_t protocolId, NetworkModule &module) {
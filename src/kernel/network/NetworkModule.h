@@ -27,7 +27,7 @@
 #include <stdint.h>
 
 #include "lib/util/collection/HashMap.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 #include "lib/util/collection/ArrayList.h"
 
 namespace Device {
@@ -94,7 +94,7 @@ protected:
 
     void invokeNextLayerModule(uint32_t protocolId, LayerInformation information, Util::Io::ByteArrayInputStream &stream, Device::Network::NetworkDevice &device);
 
-    Util::Async::Spinlock socketLock;
+    Util::Async::ReadWriteLock socketLock;
     Util::ArrayList<Socket*> socketList;
 
 private:
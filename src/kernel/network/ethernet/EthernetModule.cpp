@@ -28,7 +28,7 @@
 #include "lib/util/network/ethernet/EthernetDatagram.h"
 #include "device/network/NetworkDevice.h"
 #include "kernel/log/Log.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/io/stream/ByteArrayInputStream.h"
 #include "lib/util/io/stream/ByteArrayOutputStream.h"
@@ -65,7 +65,7 @@ void EthernetModule::readPacket(Util::Io::ByteArrayInputStream &stream, LayerInf
     auto payloadLength = information.payloadLength - Util::Network::Ethernet::EthernetHeader::HEADER_LENGTH;
     auto *datagramBuffer = stream.getBuffer() + stream.getPosition();
 
-    socketLock.acquire();
+    socketLock.acquireRead();
     for (auto *socket : socketList) {
         if (socket->getAddress() != header.getDestinationAddress()) {
             continue;
@@ -74,7 +74,7 @@ void EthernetModule::readPacket(Util::Io::ByteArrayInputStream &stream, LayerInf
         auto *datagram = new Util::Network::Ethernet::EthernetDatagram(datagramBuffer, payloadLength, header.getSourceAddress(), header.getEtherType());
         reinterpret_cast<EthernetSocket*>(socket)->handleIncomingDatagram(datagram);
     }
-    socketLock.release();
+    socketLock.releaseRead();
 
     invokeNextLayerModule(header.getEtherType(), {header.getSourceAddress(), header.getDestinationAddress(), payloadLength}, stream, device);
 }
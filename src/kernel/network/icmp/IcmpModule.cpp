@@ -30,7 +30,7 @@
 #include "kernel/network/icmp/IcmpModule.h"
 #include "device/network/NetworkDevice.h"
 #include "kernel/log/Log.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/io/stream/ByteArrayInputStream.h"
 #include "lib/util/io/stream/ByteArrayOutputStream.h"
@@ -72,14 +72,14 @@ void IcmpModule::readPacket(Util::Io::ByteArrayInputStream &stream, LayerInforma
             auto payloadLength = information.payloadLength - Util::Network::Icmp::IcmpHeader::HEADER_LENGTH;
             auto *datagramBuffer = stream.getBuffer() + stream.getPosition();
 
-            socketLock.acquire();
+            socketLock.acquireRead();
             for (auto *socket: socketList) {
                 if (socket->getAddress() == Util::Network::Ip4::Ip4Address::ANY || socket->getAddress() == information.destinationAddress) {
                     auto *datagram = new Util::Network::Icmp::IcmpDatagram(datagramBuffer, payloadLength, sourceAddress, header.getType(), header.getCode());
                     reinterpret_cast<IcmpSocket *>(socket)->handleIncomingDatagram(datagram);
                 }
             }
-            socketLock.release();
+            socketLock.releaseRead();
         }
     }
 }
@@ -29,7 +29,7 @@
 #include "device/network/NetworkDevice.h"
 #include "kernel/log/Log.h"
 #include "lib/util/base/Panic.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 #include "lib/util/io/stream/ByteArrayInputStream.h"
 #include "lib/util/io/stream/ByteArrayOutputStream.h"
 #include "lib/util/network/MacAddress.h"
@@ -81,14 +81,14 @@ void Ip4Module::readPacket(Util::Io::ByteArrayInputStream &stream, [[maybe_unuse
     auto payloadLength = header.getPayloadLength();
     auto *datagramBuffer = stream.getBuffer() + stream.getPosition();
 
-    socketLock.acquire();
+    socketLock.acquireRead();
     for (auto *socket : socketList) {
         if (socket->getAddress() == Util::Network::Ip4::Ip4Address::ANY || socket->getAddress() == header.getDestinationAddress()) {
             auto *datagram = new Util::Network::Ip4::Ip4Datagram(datagramBuffer, payloadLength, header.getSourceAddress(), header.getProtocol());
             reinterpret_cast<Ip4Socket*>(socket)->handleIncomingDatagram(datagram);
         }
     }
-    socketLock.release();
+    socketLock.releaseRead();
 
     invokeNextLayerModule(header.getProtocol(), {header.getSourceAddress(), header.getDestinationAddress(), header.getPayloadLength()}, stream, device);
 }
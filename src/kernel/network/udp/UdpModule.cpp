@@ -30,7 +30,7 @@
 #include "kernel/network/ethernet/EthernetModule.h"
 #include "device/network/NetworkDevice.h"
 #include "kernel/log/Log.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/ReadWriteLock.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/io/stream/ByteArrayInputStream.h"
 #include "lib/util/network/NetworkAddress.h"
@@ -50,7 +50,7 @@ bool UdpModule::registerSocket(Socket &socket) {
     auto &socketAddress = (Util::Network::Ip4::Ip4PortAddress&) socket.getAddress();
     bool anyAddress = socketAddress.getIp4Address() == Util::Network::Ip4::Ip4Address::ANY;
 
-    socketLock.acquire();
+    socketLock.acquireWrite();
     if (socketAddress.getPort() == 0) {
         socketAddress.setPort(generatePort(socketAddress.getIp4Address()));
     }
@@ -60,12 +60,12 @@ bool UdpModule::registerSocket(Socket &socket) {
         if ((currentAddress == Util::Network::Ip4::Ip4Address::ANY && socketAddress.getPort() == currentAddress.getPort()) ||
                 (anyAddress && currentAddress.getPort() == socketAddress.getPort()) ||
                 (currentSocket->getAddress() == socket.getAddress())) {
-            return socketLock.releaseAndReturn(false);
+            return socketLock.releaseWriteAndReturn(false);
         }
     }
 
     socketList.add(&socket);
-    return socketLock.releaseAndReturn(true);
+    return socketLock.releaseWriteAndReturn(true);
 }
 
 void UdpModule::readPacket(Util::Io::ByteArrayInputStream &stream, NetworkModule::LayerInformation information, [[maybe_unused]] Device::Network::NetworkDevice &device) {
@@ -87,7 +87,7 @@ void UdpModule::readPacket(Util::Io::ByteArrayInputStream &stream, NetworkModule
     auto payloadLength = header.getDatagramLength() - Util::Network::Udp::UdpHeader::HEADER_SIZE;
     auto *datagramBuffer = stream.getBuffer() + stream.getPosition();
 
-    socketLock.acquire();
+    socketLock.acquireRead();
     for (auto *socket : socketList) {
         auto &socketAddress = reinterpret_cast<const Util::Network::Ip4::Ip4PortAddress&>(socket->getAddress());
         if ((socketAddress.getIp4Address() == Util::Network::Ip4::Ip4Address::ANY && socketAddress.getPort() == destinationAddress.getPort()) || socketAddress == destinationAddress) {
@@ -95,7 +95,7 @@ void UdpModule::readPacket(Util::Io::ByteArrayInputStream &stream, NetworkModule
             reinterpret_cast<UdpSocket *>(socket)->handleIncomingDatagram(datagram);
         }
     }
-    socketLock.release();
+    socketLock.releaseRead();
 }
 
 void UdpModule::writePacket(const Util::Network::Ip4::Ip4PortAddress &sourceAddress, const Util::Network::Ip4::Ip4PortAddress &destinationAddress, const uint8_t *buffer, uint16_t length) {
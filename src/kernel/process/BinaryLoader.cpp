@@ -26,6 +26,7 @@
 #include "lib/util/io/stream/FileInputStream.h"
 #include "lib/util/io/file/ElfFile.h"
 #include "kernel/service/ProcessService.h"
+#include "kernel/service/CpuService.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/Thread.h"
 #include "lib/util/base/Panic.h"
@@ -67,6 +68,7 @@ void BinaryLoader::run() {
     auto &symbolTableHeader = executable.getSectionHeader(Util::Io::ElfFile::SectionType::SYMTAB);
     auto &stringTableHeader = executable.getSectionHeader(Util::Io::ElfFile::SectionType::STRTAB);
     addressSpaceHeader.symbolTableSize = symbolTableHeader.size;
+    addressSpaceHeader.fastSystemCalls = CpuService::isFastSystemCallAvailable();
 
     auto symbolTableAddress = Util::Address(buffer + symbolTableHeader.offset);
     auto stringTableAddress = Util::Address(buffer + stringTableHeader.offset);
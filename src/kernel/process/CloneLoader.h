@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_CLONELOADER_H
+#define HHUOS_CLONELOADER_H
+
+#include <stdint.h>
+
+#include "lib/util/async/Runnable.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Starts the main thread of a cloned process. It runs as a kernel thread inside the cloned address space,
+ * since the user stack of the new thread must be allocated there.
+ */
+class CloneLoader : public Util::Async::Runnable {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param name The name of the main thread
+     * @param userInstructionPointer The user space function, that starts the runnable
+     * @param runnable The runnable to execute in the cloned process (its address is valid in the cloned address space)
+     */
+    CloneLoader(const Util::String &name, uint32_t userInstructionPointer, Util::Async::Runnable *runnable);
+
+    /**
+     * Copy Constructor.
+     */
+    CloneLoader(const CloneLoader &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    CloneLoader &operator=(const CloneLoader &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~CloneLoader() override = default;
+
+    void run() override;
+
+private:
+
+    const Util::String name;
+    const uint32_t userInstructionPointer;
+    Util::Async::Runnable *runnable;
+};
+
+}
+
+#endif
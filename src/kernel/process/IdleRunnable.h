@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_IDLERUNNABLE_H
+#define HHUOS_IDLERUNNABLE_H
+
+#include "lib/util/async/Runnable.h"
+
+namespace Kernel {
+
+/**
+ * Runs on a CPU, whenever its ready queue is empty.
+ * Every CPU has its own idle thread, which is never enqueued into a ready queue.
+ * It halts the CPU until there is work again, instead of spinning (see Scheduler::idle()).
+ */
+class IdleRunnable : public Util::Async::Runnable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    IdleRunnable() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    IdleRunnable(const IdleRunnable &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IdleRunnable &operator=(const IdleRunnable &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~IdleRunnable() override = default;
+
+    void run() override;
+};
+
+}
+
+#endif
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "IoRing.h"
+
+#include "kernel/memory/VirtualAddressSpace.h"
+#include "kernel/process/Process.h"
+#include "kernel/process/Scheduler.h"
+#include "kernel/process/Thread.h"
+#include "kernel/service/FilesystemService.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/service/NetworkService.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/Service.h"
+#include "lib/util/base/String.h"
+#include "lib/util/network/Datagram.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Kernel {
+
+IoRing::IoRing(Process &process, Util::Async::IoRing::Header &header, uint32_t entryCount, uint32_t workerCount) :
+        header(header),
+        submissionEntries(reinterpret_cast<Util::Async::IoRing::SubmissionEntry*>(&header + 1)),
+        completionEntries(reinterpret_cast<Util::Async::IoRing::CompletionEntry*>(submissionEntries + entryCount)),
+        entryCount(entryCount),
+        indexMask(entryCount - 1) {
+    auto &scheduler = Service::getService<ProcessService>().getScheduler();
+
+    for (uint32_t i = 0; i < workerCount; i++) {
+        auto &worker = Thread::createKernelThread(Util::String::format("IoRing-Worker-%u", i), process, new Worker(*this));
+        workerIds.add(worker.getId());
+        scheduler.ready(worker);
+    }
+}
+
+uint32_t IoRing::submit() {
+    lock.acquire();
+    const uint32_t pending = header.submissionTail - header.submissionHead;
+    lock.release();
+
+    if (pending > 0) {
+        workerQueue.wake(pending < workerIds.size() ? pending : workerIds.size());
+    }
+
+    return pending;
+}
+
+void IoRing::stop() {
+    lock.acquire();
+    stopped = true;
+    lock.release();
+    workerQueue.wakeAll();
+
+    // A worker may stop the ring itself, if it exits the process (e.g. because of a panic during an operation)
+    auto &scheduler = Service::getService<ProcessService>().getScheduler();
+    const auto currentThreadId = scheduler.getCurrentThread().getId();
+    for (auto workerId : workerIds) {
+        auto *worker = workerId == currentThreadId ? nullptr : scheduler.getThread(workerId);
+        if (worker != nullptr) {
+            worker->join();
+        }
+    }
+}
+
+const Util::Async::IoRing::Header& IoRing::getHeader() const {
+    return header;
+}
+
+bool IoRing::takeEntry(Util::Async::IoRing::SubmissionEntry &entry) {
+    lock.acquire();
+
+    while (true) {
+        if (stopped) {
+            lock.release();
+            return false;
+        }
+
+        // The process may change the indices at any time -> Read each of them only once
+        const uint32_t submissionHead = header.submissionHead;
+        const uint32_t submissionTail = header.submissionTail;
+        const uint32_t completionCount = header.completionTail - header.completionHead;
+
+        if (submissionHead != submissionTail && runningOperations + completionCount < entryCount) {
+            entry = submissionEntries[submissionHead & indexMask];
+            header.submissionHead = submissionHead + 1;
+            runningOperations++;
+
+            lock.release();
+            return true;
+        }
+
+        workerQueue.wait(lock);
+    }
+}
+
+void IoRing::complete(const Util::Async::IoRing::SubmissionEntry &entry, bool success, uint64_t result) {
+    lock.acquire();
+
+    const uint32_t completionTail = header.completionTail;
+    completionEntries[completionTail & indexMask] = { entry.userData, result, success };
+
+    // The entry must be completely written, before the process can see the new tail
+    asm volatile ("" : : : "memory");
+    header.completionTail = completionTail + 1;
+    runningOperations--;
+
+    lock.release();
+
+    Service::getService<ProcessService>().getScheduler().wakeAddress(&header.completionTail, UINT32_MAX);
+}
+
+bool IoRing::execute(const Util::Async::IoRing::SubmissionEntry &entry, uint64_t &result) {
+    result = 0;
+
+    // The kernel cannot write to read-only user pages either, so buffers, that are written to, must be checked beforehand
+    auto &addressSpace = Service::getService<MemoryService>().getCurrentAddressSpace();
+    if ((entry.operation == Util::Async::IoRing::READ && (entry.length > UINT32_MAX || !addressSpace.isWritableUserRange(entry.buffer, static_cast<uint32_t>(entry.length)))) ||
+            (entry.operation == Util::Async::IoRing::RECEIVE && !addressSpace.isWritableUserRange(entry.buffer, sizeof(Util::Network::Datagram)))) {
+        return false;
+    }
+
+    switch (entry.operation) {
+        case Util::Async::IoRing::READ:
+            result = Service::getService<FilesystemService>().readFile(entry.fileDescriptor, static_cast<uint8_t*>(entry.buffer), entry.offset, entry.length);
+            return true;
+        case Util::Async::IoRing::WRITE:
+            result = Service::getService<FilesystemService>().writeFile(entry.fileDescriptor, static_cast<const uint8_t*>(entry.buffer), entry.offset, entry.length);
+            return true;
+        case Util::Async::IoRing::SEND: {
+            auto &datagram = *static_cast<Util::Network::Datagram*>(entry.buffer);
+            if (!Service::getService<NetworkService>().sendDatagram(entry.fileDescriptor, datagram)) {
+                return false;
+            }
+
+            result = datagram.getLength();
+            return true;
+        }
+        case Util::Async::IoRing::RECEIVE: {
+            auto &datagram = *static_cast<Util::Network::Datagram*>(entry.buffer);
+            if (!Service::getService<NetworkService>().receiveDatagram(entry.fileDescriptor, datagram)) {
+                return false;
+            }
+
+            result = datagram.getLength();
+            return true;
+        }
+        case Util::Async::IoRing::TIMEOUT:
+            Service::getService<ProcessService>().getScheduler().sleep(Util::Time::Timestamp::ofNanoseconds(entry.offset));
+            return true;
+        default:
+            return false;
+    }
+}
+
+IoRing::Worker::Worker(IoRing &ring) : ring(ring) {}
+
+void IoRing::Worker::run() {
+    Util::Async::IoRing::SubmissionEntry entry{};
+
+    while (ring.takeEntry(entry)) {
+        uint64_t result;
+        const auto success = execute(entry, result);
+        ring.complete(entry, success, result);
+    }
+}
+
+}
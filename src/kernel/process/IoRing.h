@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_IORING_H
+#define HHUOS_IORING_H
+
+#include <stdint.h>
+
+#include "kernel/process/WaitQueue.h"
+#include "lib/util/async/IoRing.h"
+#include "lib/util/async/Runnable.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Kernel {
+class Process;
+
+/**
+ * The kernel side of an I/O ring (see Util::Async::IoRing).
+ * The ring memory lives in the address space of the owning process. The worker threads are kernel threads
+ * of that process, so they can access the ring and the buffers of submitted operations directly.
+ * Each worker takes one entry from the submission queue at a time, executes it synchronously
+ * and places the result in the completion queue. This way, up to one operation per worker is in flight.
+ */
+class IoRing {
+
+public:
+    /**
+     * Constructor.
+     * Creates and starts the worker threads in the given process.
+     * The entry count must already be validated and is never read again from the header,
+     * since the process may change it at any time.
+     */
+    IoRing(Process &process, Util::Async::IoRing::Header &header, uint32_t entryCount, uint32_t workerCount);
+
+    /**
+     * Copy Constructor.
+     */
+    IoRing(const IoRing &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IoRing &operator=(const IoRing &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~IoRing() = default;
+
+    /**
+     * Wake up the workers to process new entries in the submission queue.
+     *
+     * @return The amount of submitted entries, which have not been taken by a worker yet
+     */
+    uint32_t submit();
+
+    /**
+     * Let the workers finish their current operations and wait until all of them have exited.
+     * Entries, which have not been taken yet, are discarded.
+     */
+    void stop();
+
+    [[nodiscard]] const Util::Async::IoRing::Header& getHeader() const;
+
+    static const constexpr uint32_t MAX_ENTRY_COUNT = 4096;
+    static const constexpr uint32_t MAX_WORKER_COUNT = 16;
+
+private:
+
+    class Worker : public Util::Async::Runnable {
+
+    public:
+
+        explicit Worker(IoRing &ring);
+
+        Worker(const Worker &other) = delete;
+
+        Worker &operator=(const Worker &other) = delete;
+
+        ~Worker() override = default;
+
+        void run() override;
+
+    private:
+
+        IoRing &ring;
+    };
+
+    /**
+     * Block until an entry can be taken from the submission queue.
+     * An entry is only taken, if a slot in the completion queue is left for its result.
+     *
+     * @return False, if the ring is stopped
+     */
+    bool takeEntry(Util::Async::IoRing::SubmissionEntry &entry);
+
+    void complete(const Util::Async::IoRing::SubmissionEntry &entry, bool success, uint64_t result);
+
+    static bool execute(const Util::Async::IoRing::SubmissionEntry &entry, uint64_t &result);
+
+    Util::Async::IoRing::Header &header;
+    Util::Async::IoRing::SubmissionEntry *submissionEntries;
+    Util::Async::IoRing::CompletionEntry *completionEntries;
+    uint32_t entryCount;
+    uint32_t indexMask;
+
+    uint32_t runningOperations = 0;
+    bool stopped = false;
+    Util::Async::Spinlock lock;
+    WaitQueue workerQueue;
+    Util::ArrayList<uint32_t> workerIds;
+};
+
+}
+
+#endif
@@ -40,6 +40,11 @@ Process::Process(VirtualAddressSpace &addressSpace, const Util::String &name, co
         id(idGenerator.getNextId()), name(name), addressSpace(addressSpace), workingDirectory(workingDirectory) {}
 
 Process::~Process() {
+    // The rings have been stopped before the threads of this process were killed (see stopIoRings())
+    for (auto *ring : ioRings) {
+        delete ring;
+    }
+
     Kernel::Service::getService<Kernel::MemoryService>().removeAddressSpace(addressSpace);
 }
 
@@ -93,6 +98,84 @@ const Util::HashMap<Util::String, SharedMemory*>& Process::getSharedMemory() con
     return sharedMemory;
 }
 
+bool Process::createIoRing(Util::Async::IoRing::Header &header, uint32_t workerCount) {
+    // Read the entry count only once, since the process may change it concurrently
+    const uint32_t entryCount = *reinterpret_cast<volatile uint32_t*>(&header.entryCount);
+    if (entryCount == 0 || entryCount > IoRing::MAX_ENTRY_COUNT || (entryCount & (entryCount - 1)) != 0) {
+        return false;
+    }
+
+    if (workerCount == 0 || workerCount > IoRing::MAX_WORKER_COUNT || getIoRing(header) != nullptr) {
+        return false;
+    }
+
+    // The workers write to the ring, which must therefore not lie in read-only memory
+    const auto ringSize = sizeof(Util::Async::IoRing::Header) + entryCount * (sizeof(Util::Async::IoRing::SubmissionEntry) + sizeof(Util::Async::IoRing::CompletionEntry));
+    if (!addressSpace.isWritableUserRange(&header, ringSize)) {
+        return false;
+    }
+
+    auto *ring = new IoRing(*this, header, entryCount, workerCount);
+
+    ioRingLock.acquire();
+    ioRings.add(ring);
+    ioRingLock.release();
+
+    return true;
+}
+
+IoRing* Process::getIoRing(const Util::Async::IoRing::Header &header) {
+    ioRingLock.acquire();
+
+    for (auto *ring : ioRings) {
+        if (&ring->getHeader() == &header) {
+            ioRingLock.release();
+            return ring;
+        }
+    }
+
+    ioRingLock.release();
+    return nullptr;
+}
+
+bool Process::destroyIoRing(const Util::Async::IoRing::Header &header) {
+    auto *ring = getIoRing(header);
+    if (ring == nullptr) {
+        return false;
+    }
+
+    // Only one caller may stop the ring, if it is destroyed concurrently
+    ioRingLock.acquire();
+    const auto removed = ioRings.remove(ring);
+    ioRingLock.release();
+
+    if (!removed) {
+        return false;
+    }
+
+    ring->stop();
+    delete ring;
+
+    return true;
+}
+
+void Process::stopIoRings() {
+    // Remove one ring at a time, since stopping a ring blocks until its workers have exited
+    while (true) {
+        ioRingLock.acquire();
+        if (ioRings.isEmpty()) {
+            ioRingLock.release();
+            return;
+        }
+
+        auto *ring = ioRings.removeIndex(0);
+        ioRingLock.release();
+
+        ring->stop();
+        delete ring;
+    }
+}
+
 bool Process::isFinished() const {
     return finished;
 }
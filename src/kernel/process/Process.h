@@ -27,6 +27,7 @@
 #include "FileDescriptorManager.h"
 #include "Pipe.h"
 #include "SharedMemory.h"
+#include "IoRing.h"
 #include "util/collection/HashMap.h"
 #include "util/collection/Pair.h"
 #include "lib/util/collection/Array.h"
@@ -92,6 +93,19 @@ public:
 
     const Util::HashMap<Util::String, SharedMemory*>& getSharedMemory() const;
 
+    bool createIoRing(Util::Async::IoRing::Header &header, uint32_t workerCount);
+
+    IoRing* getIoRing(const Util::Async::IoRing::Header &header);
+
+    bool destroyIoRing(const Util::Async::IoRing::Header &header);
+
+    /**
+     * Stop and delete all I/O rings of this process.
+     * Must be called before the threads of this process are killed, so that no worker is killed mid-operation
+     * (e.g. while holding a filesystem lock).
+     */
+    void stopIoRings();
+
     Util::Io::File getWorkingDirectory();
 
     bool isFinished() const;
@@ -120,6 +134,8 @@ private:
     FileDescriptorManager fileDescriptorManager;
     Util::HashMap<Util::String, Pipe*> pipes;
     Util::HashMap<Util::String, SharedMemory*> sharedMemory;
+    Util::ArrayList<IoRing*> ioRings;
+    Util::Async::Spinlock ioRingLock;
     Util::Io::File workingDirectory;
     Util::ArrayList<Thread*> threads;
     Thread *mainThread = nullptr;
@@ -23,6 +23,7 @@
 #include "lib/util/base/Address.h"
 #include "kernel/service/TimeService.h"
 #include "device/cpu/Fpu.h"
+#include "device/cpu/Cpu.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/Thread.h"
 #include "kernel/service/MemoryService.h"
@@ -37,24 +38,51 @@
 #include "lib/util/base/HeapMemoryManager.h"
 #include "kernel/service/ProcessService.h"
 #include "kernel/memory/VirtualAddressSpace.h"
+#include "kernel/service/CpuService.h"
+#include "kernel/process/IdleRunnable.h"
+#include "device/interrupt/apic/Apic.h"
+#include "device/time/apic/ApicTimer.h"
+#include "lib/util/hardware/CpuId.h"
 
 namespace Kernel {
 
-Scheduler::Scheduler() {
-    defaultFpuContext = static_cast<uint8_t*>(Service::getService<MemoryService>().allocateKernelMemory(512, 16));
-    Util::Address(defaultFpuContext).setRange(0, 512);
+bool Scheduler::monitorAvailable = false;
 
+Scheduler::Scheduler() {
     if (Device::Fpu::isAvailable()) {
         LOG_INFO("FPU detected -> Enabling FPU context switching");
-        fpu = new Device::Fpu(defaultFpuContext);
+        fpu = new Device::Fpu();
+        fpuContextSize = fpu->getContextSize();
     } else {
         LOG_WARN("No FPU present");
     }
+
+    // The XSAVE area requires 64 byte alignment and its size depends on the enabled state components
+    defaultFpuContext = static_cast<uint8_t*>(Service::getService<MemoryService>().allocateKernelMemory(fpuContextSize, Device::Fpu::CONTEXT_ALIGNMENT));
+    Util::Address(defaultFpuContext).setRange(0, fpuContextSize);
+
+    if (fpu != nullptr) {
+        fpu->initializeContext(defaultFpuContext);
+    }
+
+    if (Util::Hardware::CpuId::isAvailable() && (Util::Hardware::CpuId::getCpuInfo().features & Util::Hardware::CpuId::MONITOR)) {
+        LOG_INFO("MONITOR/MWAIT detected -> Using mwait for idle CPUs");
+        monitorAvailable = true;
+    }
 }
 
 Scheduler::~Scheduler() {
-    while (!readyQueue.isEmpty()) {
-        delete readyQueue.poll();
+    for (auto *runQueue : runQueues) {
+        if (runQueue == nullptr) {
+            continue;
+        }
+
+        while (!runQueue->isEmpty()) {
+            delete runQueue->poll();
+        }
+
+        delete runQueue->idleThread;
+        delete runQueue;
     }
 
     for (auto id : joinMap.getKeys()) {
@@ -71,124 +99,213 @@ bool Scheduler::isInitialized() const {
 }
 
 Thread& Scheduler::getCurrentThread() {
-    if (!initialized) {
-        readyQueueLock.release();
+    // Interrupts are disabled, so that the calling thread cannot be migrated to another CPU, while accessing its run queue
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto &runQueue = getCurrentRunQueue();
+    auto *currentThread = runQueue.currentThread;
+    Device::Cpu::restoreInterrupts(flags);
+
+    if (!initialized || currentThread == nullptr) {
         Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Scheduler: Trying to get current thread before initialization!");
     }
 
     return *currentThread;
 }
 
-Thread* Scheduler::getLastFpuThread() const {
-    return reinterpret_cast<Thread*>(lastFpuThread);
+Thread* Scheduler::getLastFpuThread() {
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    auto *lastFpuThread = reinterpret_cast<Thread*>(getCurrentRunQueue().lastFpuThread);
+    Device::Cpu::restoreInterrupts(flags);
+
+    return lastFpuThread;
 }
 
-void Scheduler::start() {
-    readyQueueLock.acquire();
-    if (readyQueue.isEmpty()) {
-        readyQueueLock.release();
-        Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Scheduler: No thread registered!");
+void Scheduler::registerCurrentCpu() {
+    auto cpuId = Service::getService<CpuService>().getVirtualCpuId();
+    if (runQueues[cpuId] != nullptr) {
+        Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Scheduler: CPU has already been registered!");
     }
 
-    auto *thread = readyQueue.poll();
-    currentThread = thread;
+    auto *runQueue = new RunQueue();
+    runQueue->cpuId = cpuId;
+    runQueue->idleThread = &Thread::createKernelProcessThread("Idle", new IdleRunnable());
+    runQueue->idleThread->cpuId = cpuId;
+    runQueues[cpuId] = runQueue;
 
-    Thread::startFirstThread(*currentThread);
+    // Application processors are booted one at a time, but the bootstrap processor may read the count concurrently
+    Util::Async::Atomic<uint32_t> countWrapper(runQueueCount);
+    uint32_t count;
+    do {
+        count = countWrapper.get();
+    } while (count <= cpuId && !countWrapper.compareAndSet(count, cpuId + 1));
 }
 
-void Scheduler::ready(Thread &thread) {
-    lockReadyQueue();
-    while (!joinLock.tryAcquire()) {
-        readyQueueLock.release();
-        yield();
-        lockReadyQueue();
+void Scheduler::start() {
+    if (fpu != nullptr) {
+        fpu->enableExtendedStates();
     }
 
-    if (readyQueue.contains(&thread)) {
-        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "Scheduler: Thread is already running!");
-    }
+    auto &runQueue = getCurrentRunQueue();
+    runQueue.readyQueueLock.acquire();
 
-    readyQueue.offer(&thread);
-    thread.getParent().addThread(thread);
+    // The local APIC is initialized by now. Wakeup IPIs are only sent to CPUs running their idle thread, so this is set before.
+    runQueue.localApicId = Service::getService<InterruptService>().usesApic() ? Device::LocalApic::getId() : 0;
 
-    joinMap.put(thread.getId(), new Util::ArrayList<Thread*>());
+    auto *thread = runQueue.isEmpty() ? runQueue.idleThread : runQueue.poll();
+    runQueue.currentThread = thread;
+    runQueue.idleStart = Service::getService<TimeService>().getSystemTime();
 
-    joinLock.release();
-    readyQueueLock.release();
+    Thread::startFirstThread(*thread);
 }
 
-void Scheduler::exit() {
-    lockReadyQueue();
-    while (!joinLock.tryAcquire()) {
-        readyQueueLock.release();
-        yield();
-        lockReadyQueue();
-    }
+void Scheduler::ready(Thread &thread) {
+    // Register the thread before it becomes visible to any CPU, so that it cannot exit before its join list exists
+    joinLock.acquire();
+    joinMap.put(thread.getId(), new Util::ArrayList<Thread*>());
+    joinLock.release();
 
-    // Ready threads that are joining on the current thread
-    auto threadId = currentThread->getId();
-    auto *joinList = joinMap.get(threadId);
-    for (uint32_t i = 0; i < joinList->size(); i++) {
-        readyQueue.offer(joinList->get(i));
+    thread.getParent().addThread(thread);
+
+    auto &runQueue = selectRunQueue(thread);
+    lockReadyQueue(runQueue);
+
+    if (thread.ready) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "Scheduler: Thread is already running!");
     }
 
-    delete joinMap.remove(threadId);
-    joinLock.release();
+    thread.cpuId = runQueue.cpuId;
+    thread.ready = true;
+    enqueue(runQueue, thread);
+    wakeIdleCpu(runQueue);
+
+    runQueue.readyQueueLock.release();
+}
+
+void Scheduler::exit() {
+    auto &currentThread = getCurrentThread();
+    readyJoiningThreads(currentThread.getId());
 
-    currentThread->freeUserStack();
-    currentThread->getParent().removeThread(*currentThread);
-    resetLastFpuThread(*currentThread);
-    Service::getService<ProcessService>().cleanup(currentThread);
+    currentThread.freeUserStack();
+    currentThread.getParent().removeThread(currentThread);
+    resetLastFpuThread(currentThread);
+    Service::getService<ProcessService>().cleanup(&currentThread);
 
-    readyQueueLock.release();
-    block();
+    auto &runQueue = lockCurrentRunQueue();
+    currentThread.wakeupPending = false;
+    block(runQueue);
 }
 
 void Scheduler::kill(Thread &thread) {
-    if (thread.getId() == currentThread->getId()) {
+    if (thread.getId() == getCurrentThread().getId()) {
         Util::Panic::fire(Util::Panic::INVALID_ARGUMENT,"Scheduler: A thread cannot kill itself!");
     }
 
-    lockReadyQueue();
-    while (!joinLock.tryAcquire()) {
-        readyQueueLock.release();
+    // The thread may currently be running on another CPU -> Wait until that CPU has switched away from it.
+    // Setting the killed flag prevents the thread from being enqueued again, once it gets preempted.
+    thread.killed = true;
+    auto *runQueue = &lockThreadRunQueue(thread);
+    while (runQueue->currentThread == &thread) {
+        runQueue->readyQueueLock.release();
         yield();
-        lockReadyQueue();
+        runQueue = &lockThreadRunQueue(thread);
     }
 
-    sleepQueueLock.acquire();
-    sleepList.remove(SleepEntry{&thread, Util::Time::Timestamp()});
-    sleepQueueLock.release();
+    runQueue->removeSleeper(&thread);
+    runQueue->remove(&thread);
+    thread.ready = false;
+    runQueue->readyQueueLock.release();
 
-    // Ready threads that are joining on the current thread
-    auto *joinList = joinMap.get(thread.getId());
-    for (uint32_t i = 0; i < joinList->size(); i++) {
-        readyQueue.offer(joinList->get(i));
+    auto *waitQueue = thread.waitQueue;
+    if (waitQueue != nullptr) {
+        waitQueue->remove(thread);
     }
 
-    delete joinMap.remove(thread.getId());
-    joinLock.release();
-
-    readyQueue.remove(&thread);
+    readyJoiningThreads(thread.getId());
     thread.getParent().removeThread(thread);
 
     resetLastFpuThread(thread);
     Service::getService<ProcessService>().cleanup(&thread);
-    readyQueueLock.release();
 }
 
-void Scheduler::yield(bool interrupt) {
-    if (!initialized || !readyQueueLock.tryAcquire()) {
+void Scheduler::yield(bool interrupt, uint32_t elapsedTicks) {
+    if (!initialized) {
+        return;
+    }
+
+    // The run queue may not exist yet, since yield() is called while waiting for the kernel heap lock during early boot
+    auto &cpuService = Service::getService<CpuService>();
+    auto *currentRunQueue = runQueues[cpuService.getVirtualCpuId()];
+    if (currentRunQueue == nullptr || !currentRunQueue->readyQueueLock.tryAcquire()) {
+        return;
+    }
+
+    auto &runQueue = *currentRunQueue;
+    if (runQueue.cpuId != cpuService.getVirtualCpuId()) {
+        // The calling thread has been migrated to another CPU, before acquiring the lock
+        runQueue.readyQueueLock.release();
+        return;
+    }
+
+    checkSleepList(runQueue);
+    checkDeferredWakeups(runQueue);
+    checkIncomingThreads(runQueue);
+
+    auto *current = runQueue.currentThread;
+    auto timeSliceLeft = false;
+    if (interrupt) {
+        runQueue.ticksSinceBoost += elapsedTicks;
+        if (runQueue.ticksSinceBoost >= BOOST_INTERVAL) {
+            // Periodically move all threads to the highest level, so that CPU-bound threads cannot starve
+            runQueue.ticksSinceBoost = 0;
+            boostPriorities(runQueue);
+        }
+
+        if (current != runQueue.idleThread && !current->killed) {
+            auto usedTicks = current->usedTicks + elapsedTicks;
+            if (usedTicks >= getTimeSlice(getQueueLevel(*current))) {
+                // The thread has used up its whole time slice -> Decay its priority
+                current->usedTicks = 0;
+                if (current->priorityLevel < PRIORITY_LEVELS - 1) {
+                    current->priorityLevel++;
+                }
+            } else {
+                current->usedTicks = static_cast<uint8_t>(usedTicks);
+                timeSliceLeft = true;
+            }
+        }
+    }
+
+    if (runQueue.isEmpty()) {
+        // Try to take work from a busier CPU, before idling or continuing the current thread
+        steal(runQueue, 1);
+    }
+
+    // Continue running the current thread, if no other thread is ready on this CPU
+    // or if it has time left on its slice and no thread with a higher priority is waiting.
+    // A thread, whose affinity does not allow this CPU anymore, is always switched out.
+    auto mustMigrate = current != runQueue.idleThread && !current->killed && !isAllowed(*current, runQueue.cpuId);
+    auto noneReady = runQueue.isEmpty() && (current == runQueue.idleThread || !current->killed);
+    auto keepRunning = timeSliceLeft && runQueue.getHighestReadyLevel() >= getQueueLevel(*current);
+    if ((noneReady || keepRunning) && !mustMigrate) {
+        setNextTimerEvent(runQueue);
+        runQueue.readyQueueLock.release();
         return;
     }
 
-    checkSleepList();
+    auto *next = runQueue.isEmpty() ? runQueue.idleThread : runQueue.poll();
+    runQueue.currentThread = next;
 
-    auto *current = currentThread;
-    auto *next = readyQueue.poll();
-    currentThread = next;
+    // The idle thread is never enqueued, it is only scheduled if the ready queue is empty
+    if (mustMigrate) {
+        // The thread is handed over to another CPU, after it has been switched out (see unlockReadyQueue())
+        releaseFpuContext(runQueue, *current);
+        runQueue.migratingThread = current;
+    } else if (current != runQueue.idleThread && !current->killed) {
+        enqueue(runQueue, *current);
+    }
 
-    readyQueue.offer(current);
+    accountIdleTime(runQueue, *current, *next);
+    setNextTimerEvent(runQueue);
 
     if (fpu != nullptr) {
         Device::Fpu::armFpuMonitor();
@@ -202,56 +319,126 @@ void Scheduler::yield(bool interrupt) {
     Thread::switchThread(*current, *next);
 }
 
+void Scheduler::idle() {
+    // The idle thread is never enqueued, so it always stays on its CPU
+    auto &runQueue = getCurrentRunQueue();
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+
+    // Check for work only after arming the monitor: A thread enqueued afterward either writes the wakeup signal,
+    // or sends a wakeup IPI, which stays pending until interrupts are enabled again
+    if (monitorAvailable) {
+        Device::Cpu::monitor(&runQueue.wakeupSignal);
+    }
+
+    if (runQueue.isEmpty() && runQueue.deferredWakeups == 0 && runQueue.incomingThreads == 0) {
+        if (monitorAvailable) {
+            Device::Cpu::enableInterruptsAndWait();
+        } else {
+            Device::Cpu::enableInterruptsAndHalt();
+        }
+    } else {
+        Device::Cpu::restoreInterrupts(flags);
+    }
+
+    yield();
+}
+
 void Scheduler::switchFpuContext() {
     if (fpu == nullptr) {
         Util::Panic::fire(Util::Panic::DEVICE_NOT_AVAILABLE, "FPU not found!");
     }
 
-    readyQueueLock.acquire();
+    auto &runQueue = lockCurrentRunQueue();
 
     // Disable FPU monitoring (will be enabled by scheduler at next thread switch)
     Device::Fpu::disarmFpuMonitor();
 
-    auto current = reinterpret_cast<uint32_t>(currentThread);
-    if (current == lastFpuThread) {
-        readyQueueLock.release();
+    // Each CPU has its own FPU registers -> The last FPU thread is tracked per CPU
+    auto current = reinterpret_cast<uint32_t>(runQueue.currentThread);
+    if (current == runQueue.lastFpuThread) {
+        runQueue.readyQueueLock.release();
         return;
     }
 
     fpu->switchContext();
 
-    lastFpuThread = current;
-    readyQueueLock.release();
+    runQueue.lastFpuThread = current;
+    runQueue.readyQueueLock.release();
 }
 
 uint32_t Scheduler::getThreadCount() const {
-    return readyQueue.size();
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        if (runQueues[i] != nullptr) {
+            count += runQueues[i]->getReadyCount();
+        }
+    }
+
+    return count;
 }
 
 uint8_t* Scheduler::getDefaultFpuContext() {
     return defaultFpuContext;
 }
 
+uint32_t Scheduler::getFpuContextSize() const {
+    return fpuContextSize;
+}
+
 void Scheduler::unlockReadyQueue() {
-    readyQueueLock.release();
+    auto &runQueue = getCurrentRunQueue();
+
+    // The previous thread has been switched out completely -> It may run on another CPU now
+    auto *migratingThread = runQueue.migratingThread;
+    if (migratingThread != nullptr) {
+        runQueue.migratingThread = nullptr;
+        migrate(runQueue, *migratingThread);
+    }
+
+    runQueue.readyQueueLock.release();
 }
 
 void Scheduler::block() {
-    readyQueueLock.acquire();
-
-    do {
-        checkSleepList();
-    } while (readyQueue.isEmpty());
+    block(lockCurrentRunQueue());
+}
 
-    auto *current = currentThread;
-    auto *next = readyQueue.poll();
-    currentThread = next;
+void Scheduler::block(RunQueue &runQueue) {
+    auto *current = runQueue.currentThread;
 
-    // Thread has enqueued itself into sleep list and waited so long, that it dequeued itself in the meantime
-    if (current == next) {
+    // The thread has already been unblocked, before it was able to block itself
+    if (current->wakeupPending) {
+        current->wakeupPending = false;
+        runQueue.removeSleeper(current);
+        runQueue.readyQueueLock.release();
         return;
     }
 
+    checkSleepList(runQueue);
+    checkDeferredWakeups(runQueue);
+    checkIncomingThreads(runQueue);
+
+    if (runQueue.isEmpty()) {
+        steal(runQueue, 1);
+    }
+
+    if (!isAllowed(*current, runQueue.cpuId)) {
+        // Allow any CPU to migrate the thread, once it is woken up
+        releaseFpuContext(runQueue, *current);
+    }
+
+    // Threads that block before using up their time slice are boosted, which favors interactive threads
+    if (current->priorityLevel > 0) {
+        current->priorityLevel--;
+    }
+    current->usedTicks = 0;
+
+    // Spinning here with the lock held would prevent other CPUs from unblocking threads on this CPU -> Run the idle thread instead
+    auto *next = runQueue.isEmpty() ? runQueue.idleThread : runQueue.poll();
+    current->ready = false;
+    runQueue.currentThread = next;
+    accountIdleTime(runQueue, *current, *next);
+    setNextTimerEvent(runQueue);
+
     if (fpu != nullptr) {
         Device::Fpu::armFpuMonitor();
     }
@@ -259,73 +446,496 @@ void Scheduler::block() {
     Thread::switchThread(*current, *next);
 }
 
+void Scheduler::block(const Util::Time::Timestamp &timeout) {
+    auto wakeupTime = Util::Time::Timestamp::getSystemTime() + timeout;
+
+    // The thread is added to the sleep list and blocked while holding the lock, so that it cannot be migrated in between
+    auto &runQueue = lockCurrentRunQueue();
+    runQueue.addSleeper(runQueue.currentThread, wakeupTime);
+
+    block(runQueue);
+}
+
 void Scheduler::unblock(Thread &thread) {
-    readyQueueLock.acquire();
-    readyQueue.offer(&thread);
-    readyQueueLock.release();
+    if (!Device::Cpu::areInterruptsEnabled()) {
+        // Interrupt handlers must not wait for a run queue lock, since it may be held by the interrupted thread
+        deferWakeup(thread, getThreadRunQueue(thread));
+        return;
+    }
+
+    // Threads are unblocked on the CPU they have last been running on.
+    // If the thread is still switching away on that CPU, its lock is held until the switch is complete.
+    auto &runQueue = lockThreadRunQueue(thread);
+    makeReady(runQueue, thread);
+    runQueue.readyQueueLock.release();
 }
 
 void Scheduler::sleep(const Util::Time::Timestamp &time) {
-    sleepQueueLock.acquire();
     auto wakeupTime = Util::Time::Timestamp::getSystemTime() + time;
-    sleepList.add(SleepEntry{currentThread, wakeupTime});
-    sleepQueueLock.release();
 
-    block();
+    // Any wakeup (e.g. a stale wakeup from a wait queue) ends the sleep early -> Block again until the wakeup time has been reached
+    for (auto now = Util::Time::Timestamp::getSystemTime(); now < wakeupTime; now = Util::Time::Timestamp::getSystemTime()) {
+        block(wakeupTime - now);
+    }
 }
 
 void Scheduler::join(const Thread& thread) {
+    auto &currentThread = getCurrentThread();
+    const auto threadId = thread.getId(); // The thread may already be deleted, when it has exited
+
     joinLock.acquire();
-    if (!joinMap.containsKey(thread.getId())) {
+    if (!joinMap.containsKey(threadId)) {
+        joinLock.release();
         return;
     }
 
-    auto *joinList = joinMap.get(thread.getId());
-    joinList->add(currentThread);
+    auto *joinList = joinMap.get(threadId);
+    joinList->add(&currentThread);
     joinLock.release();
 
-    block();
+    // Any wakeup (e.g. a stale wakeup from a wait queue) ends the block early -> Block again until the thread has exited
+    while (true) {
+        block();
+
+        joinLock.acquire();
+        const auto exited = !joinMap.containsKey(threadId);
+        joinLock.release();
+
+        if (exited) {
+            return;
+        }
+    }
 }
 
-void Scheduler::checkSleepList() {
-    if (sleepQueueLock.tryAcquire()) {
-        auto systemTime = Service::getService<TimeService>().getSystemTime();
-        for (uint32_t i = 0; i < sleepList.size(); i++) {
-            const auto &entry = sleepList.get(i);
-            if (systemTime >= entry.wakeupTime) {
-                readyQueue.offer(entry.thread);
-                sleepList.remove(entry);
+bool Scheduler::waitOnAddress(const volatile uint32_t *address, uint32_t expectedValue) {
+    // Read the value first, so that the page is mapped before its physical address is looked up
+    if (*address != expectedValue) {
+        return false;
+    }
+
+    auto key = getAddressKey(address);
+    if (key == 0) {
+        return false;
+    }
+
+    // Register before checking the value again, so that a wakeup in between cannot get lost
+    auto &waitQueue = addressWaitQueues[(key >> 2) % ADDRESS_WAIT_QUEUE_COUNT];
+    waitQueue.prepareToWait(key);
+    if (*address != expectedValue) {
+        waitQueue.cancelWait();
+        return false;
+    }
+
+    waitQueue.wait();
+    return true;
+}
+
+uint32_t Scheduler::wakeAddress(const volatile uint32_t *address, uint32_t count) {
+    auto key = getAddressKey(address);
+    if (key == 0) {
+        return 0;
+    }
+
+    return addressWaitQueues[(key >> 2) % ADDRESS_WAIT_QUEUE_COUNT].wake(count, key);
+}
+
+void Scheduler::setNice(Thread &thread, int8_t nice) {
+    // Takes effect the next time the thread is enqueued
+    thread.nice = nice < MIN_NICE ? MIN_NICE : (nice > MAX_NICE ? MAX_NICE : nice);
+}
+
+bool Scheduler::setAffinity(Thread &thread, uint32_t affinity) {
+    auto allowsRunningCpu = false;
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        if (runQueues[i] != nullptr && (affinity == ALL_CPUS || (i < 32 && (affinity & (1 << i)) != 0))) {
+            allowsRunningCpu = true;
+            break;
+        }
+    }
+
+    if (!allowsRunningCpu) {
+        return false;
+    }
+
+    if (runQueues[thread.cpuId] == nullptr) {
+        // The thread has not been started yet -> ready() will select an allowed CPU
+        thread.affinity = affinity;
+        return true;
+    }
+
+    auto &runQueue = lockThreadRunQueue(thread);
+    thread.affinity = affinity;
+
+    // Enqueued threads can be moved right away, unless their FPU state is still located inside their CPU's registers
+    if (!isAllowed(thread, runQueue.cpuId) && reinterpret_cast<uint32_t>(&thread) != runQueue.lastFpuThread && runQueue.remove(&thread)) {
+        migrate(runQueue, thread);
+    }
+
+    auto isCallingThread = initialized && &thread == runQueue.currentThread && &runQueue == &getCurrentRunQueue();
+    runQueue.readyQueueLock.release();
+
+    // The calling thread is moved, once it is switched out
+    if (isCallingThread && !isAllowed(thread, runQueue.cpuId)) {
+        yield();
+    }
+
+    return true;
+}
+
+void Scheduler::balance() {
+    // Called from interrupt context -> Never wait for any lock here
+    auto *currentRunQueue = runQueues[Service::getService<CpuService>().getVirtualCpuId()];
+    if (!initialized || currentRunQueue == nullptr || !currentRunQueue->readyQueueLock.tryAcquire()) {
+        return;
+    }
+
+    uint32_t maxLength = 0;
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        if (runQueues[i] != nullptr && runQueues[i]->getReadyCount() > maxLength) {
+            maxLength = runQueues[i]->getReadyCount();
+        }
+    }
+
+    // Only balance, if it moves at least one thread without making the other CPU less loaded than this one
+    auto length = currentRunQueue->getReadyCount();
+    if (maxLength > length + 1) {
+        steal(*currentRunQueue, (maxLength - length) / 2);
+    }
+
+    currentRunQueue->readyQueueLock.release();
+}
+
+Util::Array<Scheduler::CpuStatus> Scheduler::getCpuStatus() const {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        if (runQueues[i] != nullptr) {
+            count++;
+        }
+    }
+
+    auto status = Util::Array<CpuStatus>(count);
+    for (uint32_t i = 0, j = 0; i < runQueueCount && j < count; i++) {
+        const auto *runQueue = runQueues[i];
+        if (runQueue != nullptr) {
+            // Read without holding the lock, since the status is only informational
+            auto idleTime = runQueue->idleTime;
+            if (runQueue->currentThread == runQueue->idleThread) {
+                idleTime += Service::getService<TimeService>().getSystemTime() - runQueue->idleStart;
             }
+
+            status[j++] = CpuStatus{runQueue->cpuId, static_cast<uint32_t>(runQueue->getReadyCount()), runQueue->stolenThreads, runQueue->lostThreads, idleTime};
+        }
+    }
+
+    return status;
+}
+
+void Scheduler::checkSleepList(RunQueue &runQueue) {
+    if (runQueue.sleepQueue.isEmpty()) {
+        return;
+    }
+
+    // Only expired entries are touched, since the heap is ordered by wakeup time
+    auto systemTime = Service::getService<TimeService>().getSystemTime();
+    for (auto *thread = runQueue.pollExpiredSleeper(systemTime); thread != nullptr; thread = runQueue.pollExpiredSleeper(systemTime)) {
+        makeReady(runQueue, *thread);
+    }
+}
+
+void Scheduler::setNextTimerEvent(const RunQueue &runQueue) {
+    auto &interruptService = Service::getService<InterruptService>();
+    if (!interruptService.usesApic()) {
+        return;
+    }
+
+    auto &timer = interruptService.getApic().getCurrentTimer();
+    if (!timer.isTickless()) {
+        return;
+    }
+
+    // The idle thread has no time slice -> Only wake up for sleeping threads (the timer limits the delay for load balancing)
+    auto delay = Util::Time::Timestamp::ofSeconds(1);
+    const auto *current = runQueue.currentThread;
+    if (current != runQueue.idleThread) {
+        auto timeSlice = getTimeSlice(getQueueLevel(*current));
+        delay = timer.getTimeUntilYield(current->usedTicks < timeSlice ? timeSlice - current->usedTicks : 1);
+    }
+
+    if (runQueue.deferredWakeups != 0 || runQueue.incomingThreads != 0) {
+        // A thread has been unblocked by an interrupt handler or migrated to this CPU -> Run the scheduler as soon as possible
+        delay = Util::Time::Timestamp();
+    } else if (!runQueue.sleepQueue.isEmpty()) {
+        auto systemTime = Service::getService<TimeService>().getSystemTime();
+        const auto &wakeupTime = runQueue.sleepQueue.get(0).wakeupTime;
+        auto sleepDelay = wakeupTime > systemTime ? wakeupTime - systemTime : Util::Time::Timestamp();
+        if (sleepDelay < delay) {
+            delay = sleepDelay;
         }
-        sleepQueueLock.release();
+    }
+
+    timer.setNextEvent(delay);
+}
+
+void Scheduler::wakeIdleCpu(RunQueue &runQueue) {
+    // Only CPUs running their idle thread may be halted. All others will find the thread at their next scheduler call.
+    if (runQueue.currentThread != runQueue.idleThread || runQueue.cpuId == Service::getService<CpuService>().getVirtualCpuId()) {
+        return;
+    }
+
+    Util::Async::Atomic<uint32_t> signalWrapper(runQueue.wakeupSignal);
+    signalWrapper.inc();
+
+    auto &interruptService = Service::getService<InterruptService>();
+    if (!monitorAvailable && interruptService.usesApic()) {
+        Device::LocalApic::sendWakeupInterProcessorInterrupt(runQueue.localApicId);
+    }
+}
+
+void Scheduler::accountIdleTime(RunQueue &runQueue, const Thread &current, const Thread &next) {
+    if (&next == runQueue.idleThread) {
+        runQueue.idleStart = Service::getService<TimeService>().getSystemTime();
+    } else if (&current == runQueue.idleThread) {
+        runQueue.idleTime += Service::getService<TimeService>().getSystemTime() - runQueue.idleStart;
     }
 }
 
+void Scheduler::deferWakeup(Thread &thread, RunQueue &runQueue) {
+    // A thread is only added once, until its run queue has processed the wakeup
+    Util::Async::Atomic<uint32_t> queuedWrapper(thread.deferredWakeupQueued);
+    if (!queuedWrapper.compareAndSet(0, 1)) {
+        return;
+    }
+
+    // The thread must not be deleted, while it is part of the list (released in checkDeferredWakeups())
+    thread.pin();
+
+    Util::Async::Atomic<uint32_t> listWrapper(runQueue.deferredWakeups);
+    uint32_t head;
+    do {
+        head = listWrapper.get();
+        thread.nextDeferredWakeup = head;
+    } while (!listWrapper.compareAndSet(head, reinterpret_cast<uint32_t>(&thread)));
+
+    wakeIdleCpu(runQueue);
+}
+
+void Scheduler::checkDeferredWakeups(RunQueue &runQueue) {
+    if (runQueue.deferredWakeups == 0) {
+        return;
+    }
+
+    Util::Async::Atomic<uint32_t> listWrapper(runQueue.deferredWakeups);
+    auto *thread = reinterpret_cast<Thread*>(listWrapper.getAndSet(0));
+    while (thread != nullptr) {
+        auto *next = reinterpret_cast<Thread*>(thread->nextDeferredWakeup);
+        Util::Async::Atomic<uint32_t> queuedWrapper(thread->deferredWakeupQueued);
+        queuedWrapper.set(0);
+
+        if (thread->cpuId != runQueue.cpuId) {
+            // The thread has been stolen by another CPU in the meantime
+            deferWakeup(*thread, getThreadRunQueue(*thread));
+        } else {
+            makeReady(runQueue, *thread);
+        }
+
+        thread->unpin();
+        thread = next;
+    }
+}
+
+uint32_t Scheduler::getAddressKey(const volatile uint32_t *address) {
+    auto &addressSpace = getCurrentThread().getParent().getAddressSpace();
+
+    return reinterpret_cast<uint32_t>(addressSpace.getPhysicalAddress(const_cast<uint32_t*>(address)));
+}
+
+void Scheduler::makeReady(RunQueue &runQueue, Thread &thread) {
+    // A killed thread must never be enqueued again (it has already been removed from its run queue by kill())
+    if (thread.killed) {
+        return;
+    }
+
+    // Any wakeup ends a timed block
+    runQueue.removeSleeper(&thread);
+
+    if (thread.ready) {
+        // The thread is running or already enqueued -> Its next call to block() returns immediately
+        thread.wakeupPending = true;
+        return;
+    }
+
+    thread.ready = true;
+    if (!isAllowed(thread, runQueue.cpuId) && reinterpret_cast<uint32_t>(&thread) != runQueue.lastFpuThread) {
+        migrate(runQueue, thread);
+        return;
+    }
+
+    enqueue(runQueue, thread);
+    wakeIdleCpu(runQueue);
+}
+
+uint32_t Scheduler::steal(RunQueue &thief, uint32_t count) {
+    // Enqueuing may allocate memory, while holding two ready queue locks (see lockReadyQueue())
+    auto &kernelSpace = Kernel::Service::getService<Kernel::MemoryService>().getKernelAddressSpace();
+    if (count == 0 || kernelSpace.getMemoryManager().isLocked()) {
+        return 0;
+    }
+
+    RunQueue *victim = nullptr;
+    uint32_t maxLength = 0;
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        auto *runQueue = runQueues[i];
+        if (runQueue != nullptr && runQueue != &thief && runQueue->getReadyCount() > maxLength) {
+            victim = runQueue;
+            maxLength = runQueue->getReadyCount();
+        }
+    }
+
+    // The thief is already holding its own lock -> Do not wait for the victim's lock, since it may try to steal from us as well
+    if (victim == nullptr || !victim->readyQueueLock.tryAcquire()) {
+        return 0;
+    }
+
+    // The victim polls from the head of its highest level, so threads are taken from the tail of its lowest level
+    uint32_t stolen = 0;
+    for (auto i = victim->getReadyCount(); i > 0 && stolen < count; i--) {
+        auto *thread = victim->get(i - 1);
+        if (!isMigratable(*victim, *thread, thief.cpuId)) {
+            continue;
+        }
+
+        victim->remove(thread);
+        thread->cpuId = thief.cpuId;
+        enqueue(thief, *thread);
+        stolen++;
+    }
+
+    victim->lostThreads += stolen;
+    thief.stolenThreads += stolen;
+    victim->readyQueueLock.release();
+
+    return stolen;
+}
+
+bool Scheduler::isMigratable(const RunQueue &runQueue, const Thread &thread, uint8_t targetCpuId) {
+    // The FPU state of the victim's last FPU thread is still located inside the victim's FPU registers
+    return &thread != runQueue.currentThread && reinterpret_cast<uint32_t>(&thread) != runQueue.lastFpuThread && !thread.killed && isAllowed(thread, targetCpuId);
+}
+
+bool Scheduler::isAllowed(const Thread &thread, uint8_t cpuId) {
+    return thread.affinity == ALL_CPUS || (cpuId < 32 && (thread.affinity & (1 << cpuId)) != 0);
+}
+
+void Scheduler::migrate(RunQueue &runQueue, Thread &thread) {
+    // Called while holding the lock of the thread's run queue, for a ready thread that is neither running nor enqueued
+    auto &target = selectRunQueue(thread);
+    if (&target == &runQueue || !isAllowed(thread, target.cpuId)) {
+        // No CPU allowed by the affinity mask is running -> Keep the thread here
+        enqueue(runQueue, thread);
+        wakeIdleCpu(runQueue);
+        return;
+    }
+
+    // A thread's CPU is only changed while holding the lock of its previous run queue.
+    // The target lock is not taken here, since another CPU may be waiting for our lock while holding its own.
+    thread.cpuId = target.cpuId;
+
+    Util::Async::Atomic<uint32_t> listWrapper(target.incomingThreads);
+    uint32_t head;
+    do {
+        head = listWrapper.get();
+        thread.nextIncomingThread = head;
+    } while (!listWrapper.compareAndSet(head, reinterpret_cast<uint32_t>(&thread)));
+
+    wakeIdleCpu(target);
+}
+
+void Scheduler::checkIncomingThreads(RunQueue &runQueue) {
+    if (runQueue.incomingThreads == 0) {
+        return;
+    }
+
+    Util::Async::Atomic<uint32_t> listWrapper(runQueue.incomingThreads);
+    auto *thread = reinterpret_cast<Thread*>(listWrapper.getAndSet(0));
+    while (thread != nullptr) {
+        auto *next = reinterpret_cast<Thread*>(thread->nextIncomingThread);
+        if (!thread->killed) {
+            enqueue(runQueue, *thread);
+        }
+
+        thread = next;
+    }
+}
+
+void Scheduler::releaseFpuContext(RunQueue &runQueue, Thread &thread) {
+    // Must be called on the CPU of the given run queue
+    if (fpu == nullptr || reinterpret_cast<uint32_t>(&thread) != runQueue.lastFpuThread) {
+        return;
+    }
+
+    fpu->saveContext(thread.getFpuContext());
+    runQueue.lastFpuThread = 0;
+}
+
 void Scheduler::resetLastFpuThread(Thread &terminatedThread) {
-    Util::Async::Atomic<uint32_t> wrapper(lastFpuThread);
-    wrapper.compareAndSet(reinterpret_cast<uint32_t>(&terminatedThread), 0);
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        if (runQueues[i] != nullptr) {
+            Util::Async::Atomic<uint32_t> wrapper(runQueues[i]->lastFpuThread);
+            wrapper.compareAndSet(reinterpret_cast<uint32_t>(&terminatedThread), 0);
+        }
+    }
+}
+
+void Scheduler::readyJoiningThreads(uint32_t threadId) {
+    // Unblock the joining threads before releasing the lock, so that no wakeup arrives after they have seen the thread exit
+    joinLock.acquire();
+    auto *joinList = joinMap.remove(threadId);
+    if (joinList == nullptr) {
+        joinLock.release();
+        return;
+    }
+
+    for (uint32_t i = 0; i < joinList->size(); i++) {
+        unblock(*joinList->get(i));
+    }
+
+    joinLock.release();
+    delete joinList;
 }
 
 Thread* Scheduler::getThread(uint32_t id) {
-    readyQueueLock.acquire();
-    for (uint32_t i = 0; i < readyQueue.size(); i++) {
-        auto *thread = readyQueue.get(i);
-        if (thread->getId() == id) {
-            readyQueueLock.release();
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        auto *runQueue = runQueues[i];
+        if (runQueue == nullptr) {
+            continue;
+        }
+
+        // Threads, that are running on another CPU, are found as well.
+        // Since the lock is held until a thread switch is complete, a thread not found here is not in use by any CPU.
+        runQueue->readyQueueLock.acquire();
+        if (runQueue->currentThread != nullptr && runQueue->currentThread->getId() == id) {
+            auto *thread = runQueue->currentThread;
+            runQueue->readyQueueLock.release();
             return thread;
         }
-    }
-    readyQueueLock.release();
 
-    sleepQueueLock.acquire();
-    for (uint32_t i = 0; i < sleepList.size(); i++) {
-        const auto &entry = sleepList.get(i);
-        if (entry.thread->getId() == id) {
-            sleepQueueLock.release();
-            return entry.thread;
+        for (uint32_t j = 0; j < runQueue->getReadyCount(); j++) {
+            auto *thread = runQueue->get(j);
+            if (thread->getId() == id) {
+                runQueue->readyQueueLock.release();
+                return thread;
+            }
+        }
+
+        for (uint32_t j = 0; j < runQueue->sleepQueue.size(); j++) {
+            const auto &entry = runQueue->sleepQueue.get(j);
+            if (entry.thread->getId() == id) {
+                runQueue->readyQueueLock.release();
+                return entry.thread;
+            }
         }
+        runQueue->readyQueueLock.release();
     }
-    sleepQueueLock.release();
 
     return nullptr;
 }
@@ -336,17 +946,82 @@ void Scheduler::removeFromJoinMap(uint32_t threadId) {
     joinLock.release();
 }
 
-void Scheduler::lockReadyQueue() {
+Scheduler::RunQueue& Scheduler::getCurrentRunQueue() {
+    auto *runQueue = runQueues[Service::getService<CpuService>().getVirtualCpuId()];
+    if (runQueue == nullptr) {
+        Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Scheduler: Calling CPU has not been registered!");
+    }
+
+    return *runQueue;
+}
+
+Scheduler::RunQueue& Scheduler::getThreadRunQueue(const Thread &thread) {
+    auto *runQueue = runQueues[thread.cpuId];
+    if (runQueue == nullptr) {
+        Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Scheduler: Thread is assigned to an unknown CPU!");
+    }
+
+    return *runQueue;
+}
+
+Scheduler::RunQueue& Scheduler::selectRunQueue(const Thread &thread) {
+    // The load is read without holding any locks, since it is only used as a hint
+    auto *selected = &getCurrentRunQueue();
+    auto minLoad = isAllowed(thread, selected->cpuId) ? selected->getLoad() : UINT32_MAX;
+
+    for (uint32_t i = 0; i < runQueueCount; i++) {
+        auto *runQueue = runQueues[i];
+        if (runQueue != nullptr && isAllowed(thread, runQueue->cpuId) && runQueue->getLoad() < minLoad) {
+            selected = runQueue;
+            minLoad = runQueue->getLoad();
+        }
+    }
+
+    return *selected;
+}
+
+Scheduler::RunQueue& Scheduler::lockCurrentRunQueue() {
+    auto &cpuService = Service::getService<CpuService>();
+
+    while (true) {
+        auto &runQueue = getCurrentRunQueue();
+        runQueue.readyQueueLock.acquire();
+
+        // The calling thread may have been migrated to another CPU, before the lock has been acquired.
+        // Once the lock is held, it cannot be preempted or stolen anymore.
+        if (runQueue.cpuId == cpuService.getVirtualCpuId()) {
+            return runQueue;
+        }
+
+        runQueue.readyQueueLock.release();
+    }
+}
+
+Scheduler::RunQueue& Scheduler::lockThreadRunQueue(const Thread &thread) {
+    while (true) {
+        auto &runQueue = getThreadRunQueue(thread);
+        lockReadyQueue(runQueue);
+
+        // A thread's CPU is only changed while holding the lock of its previous run queue
+        if (thread.cpuId == runQueue.cpuId) {
+            return runQueue;
+        }
+
+        runQueue.readyQueueLock.release();
+    }
+}
+
+void Scheduler::lockReadyQueue(RunQueue &runQueue) {
     auto &kernelSpace = Kernel::Service::getService<Kernel::MemoryService>().getKernelAddressSpace();
 
     // We need to make sure, that both the kernel memory manager and the ready queue are currently not locked.
     // Otherwise, a deadlock may occur: Since we are holding the ready queue lock,
     // the scheduler won't switch threads anymore, and none of the locks will ever be released
-    readyQueueLock.acquire();
+    runQueue.readyQueueLock.acquire();
     while (kernelSpace.getMemoryManager().isLocked()) {
-        readyQueueLock.release();
+        runQueue.readyQueueLock.release();
         yield();
-        readyQueueLock.acquire();
+        runQueue.readyQueueLock.acquire();
     }
 }
 
@@ -354,4 +1029,188 @@ bool Scheduler::SleepEntry::operator!=(const Scheduler::SleepEntry &other) const
     return thread->getId() != other.thread->getId();
 }
 
+uint8_t Scheduler::getQueueLevel(const Thread &thread) {
+    // Each step of 5 nice values shifts the thread by one priority level
+    auto level = static_cast<int32_t>(thread.priorityLevel) + thread.nice / 5;
+    return level < 0 ? 0 : (level >= PRIORITY_LEVELS ? PRIORITY_LEVELS - 1 : level);
+}
+
+uint32_t Scheduler::getTimeSlice(uint8_t level) {
+    // Lower priority levels get longer time slices (1, 1, 2, 2, 4, 4, 8, 8 ticks)
+    return 1 << (level / 2);
+}
+
+void Scheduler::enqueue(RunQueue &runQueue, Thread &thread) {
+    runQueue.offer(&thread, getQueueLevel(thread));
+}
+
+void Scheduler::boostPriorities(RunQueue &runQueue) {
+    if (runQueue.currentThread != nullptr) {
+        runQueue.currentThread->priorityLevel = 0;
+        runQueue.currentThread->usedTicks = 0;
+    }
+
+    for (uint32_t level = 1; level < PRIORITY_LEVELS; level++) {
+        auto &queue = runQueue.readyQueues[level];
+        while (!queue.isEmpty()) {
+            auto *thread = queue.poll();
+            thread->priorityLevel = 0;
+            thread->usedTicks = 0;
+            enqueue(runQueue, *thread);
+        }
+    }
+}
+
+uint32_t Scheduler::RunQueue::getLoad() const {
+    return getReadyCount() + (currentThread != idleThread ? 1 : 0);
+}
+
+uint32_t Scheduler::RunQueue::getReadyCount() const {
+    uint32_t count = 0;
+    for (const auto &queue : readyQueues) {
+        count += queue.size();
+    }
+
+    return count;
+}
+
+bool Scheduler::RunQueue::isEmpty() const {
+    for (const auto &queue : readyQueues) {
+        if (!queue.isEmpty()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Scheduler::RunQueue::offer(Thread *thread, uint8_t level) {
+    readyQueues[level].offer(thread);
+}
+
+Thread* Scheduler::RunQueue::poll() {
+    for (auto &queue : readyQueues) {
+        if (!queue.isEmpty()) {
+            return queue.poll();
+        }
+    }
+
+    Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Scheduler: Ready queue is empty!");
+}
+
+Thread* Scheduler::RunQueue::get(uint32_t index) {
+    // Threads are indexed in scheduling order, from the head of the highest level to the tail of the lowest level
+    for (auto &queue : readyQueues) {
+        if (index < queue.size()) {
+            return queue.get(index);
+        }
+
+        index -= queue.size();
+    }
+
+    Util::Panic::fire(Util::Panic::OUT_OF_BOUNDS, "Scheduler: Ready queue index out of bounds!");
+}
+
+bool Scheduler::RunQueue::remove(Thread *thread) {
+    for (auto &queue : readyQueues) {
+        if (queue.remove(thread)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint8_t Scheduler::RunQueue::getHighestReadyLevel() const {
+    for (uint8_t level = 0; level < PRIORITY_LEVELS; level++) {
+        if (!readyQueues[level].isEmpty()) {
+            return level;
+        }
+    }
+
+    return PRIORITY_LEVELS;
+}
+
+void Scheduler::RunQueue::addSleeper(Thread *thread, const Util::Time::Timestamp &wakeupTime) {
+    sleepQueue.add(SleepEntry{thread, wakeupTime});
+    thread->sleepIndex = static_cast<int32_t>(sleepQueue.size() - 1);
+    siftUp(sleepQueue.size() - 1);
+}
+
+void Scheduler::RunQueue::removeSleeper(Thread *thread) {
+    if (thread->sleepIndex < 0) {
+        return;
+    }
+
+    // Replace the entry with the last one and restore the heap property from there
+    auto index = static_cast<uint32_t>(thread->sleepIndex);
+    auto last = sleepQueue.removeIndex(sleepQueue.size() - 1);
+    thread->sleepIndex = -1;
+
+    if (index < sleepQueue.size()) {
+        setSleepEntry(index, last);
+        siftUp(index);
+        siftDown(static_cast<uint32_t>(last.thread->sleepIndex));
+    }
+}
+
+Thread* Scheduler::RunQueue::pollExpiredSleeper(const Util::Time::Timestamp &systemTime) {
+    if (sleepQueue.isEmpty() || sleepQueue.get(0).wakeupTime > systemTime) {
+        return nullptr;
+    }
+
+    auto *thread = sleepQueue.get(0).thread;
+    removeSleeper(thread);
+
+    return thread;
+}
+
+void Scheduler::RunQueue::setSleepEntry(uint32_t index, const SleepEntry &entry) {
+    sleepQueue.set(index, entry);
+    entry.thread->sleepIndex = static_cast<int32_t>(index);
+}
+
+void Scheduler::RunQueue::siftUp(uint32_t index) {
+    auto entry = sleepQueue.get(index);
+    while (index > 0) {
+        auto parentIndex = (index - 1) / 2;
+        auto parent = sleepQueue.get(parentIndex);
+        if (parent.wakeupTime <= entry.wakeupTime) {
+            break;
+        }
+
+        setSleepEntry(index, parent);
+        index = parentIndex;
+    }
+
+    setSleepEntry(index, entry);
+}
+
+void Scheduler::RunQueue::siftDown(uint32_t index) {
+    auto entry = sleepQueue.get(index);
+    auto size = sleepQueue.size();
+
+    while (true) {
+        auto childIndex = 2 * index + 1;
+        if (childIndex >= size) {
+            break;
+        }
+
+        // Select the earlier of both children
+        if (childIndex + 1 < size && sleepQueue.get(childIndex + 1).wakeupTime < sleepQueue.get(childIndex).wakeupTime) {
+            childIndex++;
+        }
+
+        auto child = sleepQueue.get(childIndex);
+        if (entry.wakeupTime <= child.wakeupTime) {
+            break;
+        }
+
+        setSleepEntry(index, child);
+        index = childIndex;
+    }
+
+    setSleepEntry(index, entry);
+}
+
 }
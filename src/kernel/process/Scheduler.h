@@ -24,12 +24,14 @@
 #include <stdint.h>
 
 #include "lib/util/collection/ArrayListQueue.h"
+#include "lib/util/collection/Array.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/collection/HashMap.h"
 #include "lib/util/time/Timestamp.h"
 #include "kernel/service/InterruptService.h"
 #include "kernel/service/Service.h"
+#include "kernel/process/WaitQueue.h"
 
 namespace Device {
 class Fpu;
@@ -70,12 +72,20 @@ public:
     bool isInitialized() const;
 
     /**
-     * Start the first thread.
+     * Create the run queue and idle thread of the calling CPU.
+     * This is called once by the bootstrap processor, right after the process service has been registered,
+     * and once by every application processor during its bring-up, before it starts scheduling.
+     */
+    void registerCurrentCpu();
+
+    /**
+     * Start scheduling on the calling CPU.
+     * This is called once by the bootstrap processor and once by every application processor.
      */
     void start();
 
     /**
-     * Registers a new Thread.
+     * Registers a new Thread and enqueues it into the ready queue of the least loaded CPU.
      *
      * @param thread A Thread.
      */
@@ -86,10 +96,24 @@ public:
      */
     void exit();
 
-    void yield(bool interrupt = false);
+    /**
+     * Give up the CPU to the next thread, that is ready on the current CPU.
+     *
+     * @param interrupt Whether the call originates from the timer interrupt
+     * @param elapsedTicks The amount of scheduler ticks, that have passed since the last timer interrupt.
+     *                     In tickless mode, this may be zero (e.g. if the interrupt has been programmed to wake up a sleeping thread).
+     */
+    void yield(bool interrupt = false, uint32_t elapsedTicks = 1);
 
     void switchFpuContext();
 
+    /**
+     * Called in a loop by the idle thread of each CPU.
+     * If there is no work for the calling CPU, it is halted (via mwait, if supported, or hlt otherwise)
+     * until an interrupt occurs or another CPU enqueues a thread into its ready queue.
+     */
+    void idle();
+
     /**
      * Kills a specific Thread.
      *
@@ -99,6 +123,15 @@ public:
 
     void block();
 
+    /**
+     * Block the current thread, until it is unblocked or the given time has passed.
+     */
+    void block(const Util::Time::Timestamp &timeout);
+
+    /**
+     * Make a blocked thread ready again. In interrupt context, the thread is only marked for wakeup
+     * and becomes ready the next time its CPU runs the scheduler, since the interrupted thread may hold a run queue lock.
+     */
     void unblock(Thread &thread);
 
     void sleep(const Util::Time::Timestamp &time);
@@ -106,13 +139,49 @@ public:
     void join(const Thread &thread);
 
     /**
-     * Returns the activeFlag Thread.
+     * Block the current thread, as long as the value at the given address equals the expected value,
+     * until wakeAddress() is called for the same address (used for the WAIT_ON_ADDRESS system call).
+     * Threads are identified by the physical address, so waiting works across processes for shared memory as well.
+     *
+     * @return true, if the thread has been blocked
+     */
+    bool waitOnAddress(const volatile uint32_t *address, uint32_t expectedValue);
+
+    /**
+     * Wake up to count threads waiting on the given address.
+     *
+     * @return The amount of threads that have been woken up
+     */
+    uint32_t wakeAddress(const volatile uint32_t *address, uint32_t count);
+
+    /**
+     * Set the nice value of a thread, which biases its priority level.
+     * Negative values raise the thread's priority, positive values lower it.
+     *
+     * @param thread The thread
+     * @param nice The nice value (clamped to [MIN_NICE, MAX_NICE])
+     */
+    void setNice(Thread &thread, int8_t nice);
+
+    /**
+     * Restrict the CPUs, a thread may run on (bit n allows the CPU with virtual id n).
+     * CPUs with an id above 31 are only allowed by ALL_CPUS.
+     * Enqueued threads are moved immediately, running and blocked threads follow the next time they are preempted or woken up.
+     *
+     * @param thread The thread
+     * @param affinity The affinity mask
+     * @return false, if the mask does not contain any running CPU (the affinity is not changed in that case)
+     */
+    bool setAffinity(Thread &thread, uint32_t affinity);
+
+    /**
+     * Returns the Thread, that is currently running on the calling CPU.
      *
-     * @return The activeFlag Thread
+     * @return The current Thread
      */
     Thread& getCurrentThread();
 
-    Thread* getLastFpuThread() const;
+    Thread* getLastFpuThread();
 
     Thread* getThread(uint32_t id);
 
@@ -120,17 +189,38 @@ public:
 
     uint8_t* getDefaultFpuContext();
 
+    /**
+     * Get the size of a thread's FPU context in bytes (depends on the save mechanism supported by the CPU).
+     */
+    [[nodiscard]] uint32_t getFpuContextSize() const;
+
     void unlockReadyQueue();
 
     void removeFromJoinMap(uint32_t threadId);
 
-private:
+    /**
+     * Move threads from the busiest CPU to the calling CPU, if its ready queue is considerably shorter.
+     * This is called periodically by each CPU's timer interrupt.
+     */
+    void balance();
+
+    struct CpuStatus {
+        uint8_t cpuId;
+        uint32_t readyThreads;
+        uint32_t stolenThreads;
+        uint32_t lostThreads;
+        Util::Time::Timestamp idleTime;
+    };
 
-    void lockReadyQueue();
+    Util::Array<CpuStatus> getCpuStatus() const;
 
-    void checkSleepList();
+    static const constexpr uint32_t MAX_CPU_COUNT = 256;
+    static const constexpr uint8_t PRIORITY_LEVELS = 8; // Level 0 is the highest priority
+    static const constexpr int8_t MIN_NICE = -20;
+    static const constexpr int8_t MAX_NICE = 19;
+    static const constexpr uint32_t ALL_CPUS = UINT32_MAX;
 
-    void resetLastFpuThread(Thread &terminatedThread);
+private:
 
     struct SleepEntry {
         Thread *thread;
@@ -139,20 +229,136 @@ private:
         bool operator!=(const SleepEntry &other) const;
     };
 
-    bool initialized = false;
-    Thread *currentThread = nullptr;
+    /**
+     * Scheduling state of a single CPU.
+     * Each CPU only switches between threads from its own ready queue and only the owning CPU creates its run queue (see registerCurrentCpu()).
+     * Other CPUs may enqueue threads into it or steal threads from its tail, while holding its lock.
+     * The sleep queue is protected by the ready queue lock as well.
+     */
+    struct RunQueue {
+        uint8_t cpuId;
+        uint8_t localApicId = 0;
+        Thread *currentThread = nullptr;
+        Thread *idleThread = nullptr;
+        uint32_t lastFpuThread = 0; // Actually a pointer, but needs to be a uint32_t for atomic operations
+
+        Util::ArrayListQueue<Thread*> readyQueues[PRIORITY_LEVELS]; // Multilevel feedback queue (one FIFO per priority level)
+        Util::Async::Spinlock readyQueueLock;
+        uint32_t ticksSinceBoost = 0;
+
+        Util::ArrayList<SleepEntry> sleepQueue; // Binary min-heap ordered by wakeup time
+
+        uint32_t deferredWakeups = 0; // Lock-free list of threads unblocked in interrupt context (actually a pointer)
+        uint32_t incomingThreads = 0; // Lock-free list of ready threads migrated to this CPU (actually a pointer)
+        Thread *migratingThread = nullptr; // Preempted thread, that is handed over to another CPU once it has been switched out
+
+        uint32_t stolenThreads = 0; // Threads this CPU has taken from other CPUs
+        uint32_t lostThreads = 0; // Threads other CPUs have taken from this CPU
+
+        uint32_t wakeupSignal = 0; // Monitored by the idle thread -> Written by other CPUs to end mwait
+        Util::Time::Timestamp idleTime; // Total time spent in the idle thread
+        Util::Time::Timestamp idleStart; // Time at which the idle thread has last been scheduled
+
+        uint32_t getLoad() const;
+
+        uint32_t getReadyCount() const;
+
+        bool isEmpty() const;
+
+        void offer(Thread *thread, uint8_t level);
+
+        Thread* poll();
+
+        Thread* get(uint32_t index);
+
+        bool remove(Thread *thread);
+
+        uint8_t getHighestReadyLevel() const;
+
+        void addSleeper(Thread *thread, const Util::Time::Timestamp &wakeupTime);
+
+        void removeSleeper(Thread *thread);
+
+        Thread* pollExpiredSleeper(const Util::Time::Timestamp &systemTime);
+
+        void setSleepEntry(uint32_t index, const SleepEntry &entry);
+
+        void siftUp(uint32_t index);
+
+        void siftDown(uint32_t index);
+    };
+
+    RunQueue& getCurrentRunQueue();
+
+    RunQueue& getThreadRunQueue(const Thread &thread);
+
+    RunQueue& selectRunQueue(const Thread &thread);
+
+    RunQueue& lockCurrentRunQueue();
+
+    RunQueue& lockThreadRunQueue(const Thread &thread);
+
+    void lockReadyQueue(RunQueue &runQueue);
+
+    void block(RunQueue &runQueue);
+
+    void makeReady(RunQueue &runQueue, Thread &thread);
+
+    uint32_t steal(RunQueue &thief, uint32_t count);
+
+    static bool isMigratable(const RunQueue &runQueue, const Thread &thread, uint8_t targetCpuId);
+
+    static bool isAllowed(const Thread &thread, uint8_t cpuId);
+
+    void migrate(RunQueue &runQueue, Thread &thread);
+
+    void checkIncomingThreads(RunQueue &runQueue);
+
+    void releaseFpuContext(RunQueue &runQueue, Thread &thread);
+
+    static uint8_t getQueueLevel(const Thread &thread);
+
+    static uint32_t getTimeSlice(uint8_t level);
+
+    static void enqueue(RunQueue &runQueue, Thread &thread);
+
+    static void boostPriorities(RunQueue &runQueue);
+
+    void checkSleepList(RunQueue &runQueue);
+
+    static void deferWakeup(Thread &thread, RunQueue &runQueue);
+
+    void checkDeferredWakeups(RunQueue &runQueue);
+
+    uint32_t getAddressKey(const volatile uint32_t *address);
+
+    static void setNextTimerEvent(const RunQueue &runQueue);
+
+    static void wakeIdleCpu(RunQueue &runQueue);
+
+    static void accountIdleTime(RunQueue &runQueue, const Thread &current, const Thread &next);
+
+    void resetLastFpuThread(Thread &terminatedThread);
+
+    void readyJoiningThreads(uint32_t threadId);
+
+    volatile bool initialized = false;
 
     Device::Fpu *fpu = nullptr;
     uint8_t *defaultFpuContext = nullptr;
-    uint32_t lastFpuThread = 0; // Actually a pointer, but needs to be a uint32_t for atomic operations
+    uint32_t fpuContextSize = 512;
+
+    static bool monitorAvailable;
 
     InterruptVector timerInterrupt = Service::getService<InterruptService>().getTimerInterrupt();
 
-    Util::ArrayListQueue<Thread*> readyQueue;
-    Util::Async::Spinlock readyQueueLock;
+    RunQueue *runQueues[MAX_CPU_COUNT]{};
+    uint32_t runQueueCount = 0; // Highest virtual CPU id with a run queue + 1
+
+    static const constexpr uint32_t BOOST_INTERVAL = 100; // Scheduler ticks, after which all threads of a CPU are moved to the highest level
+    static const constexpr uint32_t ADDRESS_WAIT_QUEUE_COUNT = 64;
 
-    Util::ArrayList<SleepEntry> sleepList;
-    Util::Async::Spinlock sleepQueueLock;
+    WaitQueue addressWaitQueues[ADDRESS_WAIT_QUEUE_COUNT]; // Waiting threads are hashed by physical address
 
     Util::HashMap<uint32_t, Util::ArrayList<Thread*>*> joinMap;
     Util::Async::Spinlock joinLock;
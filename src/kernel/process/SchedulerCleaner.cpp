@@ -69,8 +69,8 @@ void SchedulerCleaner::cleanupThreads() {
     while (threadQueue.size() > 0) {
         auto *thread = threadQueue.poll();
 
-        if (scheduler.getThread(thread->getId())) {
-            // Thread is still inside ready queue -> Wait until the scheduler has finished blocking the thread
+        if (scheduler.getThread(thread->getId()) || thread->isPinned()) {
+            // Thread is still inside ready queue or about to be woken up -> Wait until the scheduler is done with the thread
             threadQueue.add(thread);
             Util::Async::Thread::yield();
         } else {
@@ -22,10 +22,13 @@
 #include "Thread.h"
 #include "kernel/service/MemoryService.h"
 #include "lib/util/async/IdGenerator.h"
+#include "lib/util/async/Atomic.h"
 #include "lib/util/async/Runnable.h"
 #include "lib/util/base/Constants.h"
+#include "lib/util/base/ObjectCache.h"
 #include "kernel/process/Process.h"
 #include "device/cpu/Cpu.h"
+#include "device/cpu/Fpu.h"
 #include "filesystem/Filesystem.h"
 #include "kernel/memory/MemoryLayout.h"
 #include "kernel/service/Service.h"
@@ -44,19 +47,33 @@ extern "C" void release_scheduler_lock() {
 namespace Kernel {
 
 Util::Async::IdGenerator Thread::idGenerator;
+static Util::ObjectCache threadCache(sizeof(Thread), alignof(Thread));
 
 Thread::Thread(const Util::String &name, Process &parent, Util::Async::Runnable *runnable, uint32_t userInstructionPointer, uint32_t *kernelStack, uint32_t *userStack) :
         id(idGenerator.getNextId()), name(name), parent(parent), runnable(runnable), userInstructionPointer(userInstructionPointer), kernelStack(kernelStack), userStack(userStack),
-        fpuContext(static_cast<uint8_t*>(Service::getService<MemoryService>().allocateKernelMemory(512, 16))) {
-    auto defaultFpuContext = Util::Address(Service::getService<ProcessService>().getScheduler().getDefaultFpuContext());
-    Util::Address(fpuContext).copyRange(defaultFpuContext, 512);
+        fpuContext(static_cast<uint8_t*>(Service::getService<MemoryService>().allocateKernelMemory(Service::getService<ProcessService>().getScheduler().getFpuContextSize(), Device::Fpu::CONTEXT_ALIGNMENT))) {
+    auto &scheduler = Service::getService<ProcessService>().getScheduler();
+    auto defaultFpuContext = Util::Address(scheduler.getDefaultFpuContext());
+    Util::Address(fpuContext).copyRange(defaultFpuContext, scheduler.getFpuContextSize());
+}
+
+void* Thread::operator new(size_t size) {
+    return size == threadCache.getObjectSize() ? threadCache.allocate() : ::operator new(size);
+}
+
+void Thread::operator delete(void *pointer, size_t size) {
+    if (size == threadCache.getObjectSize()) {
+        threadCache.free(pointer);
+    } else {
+        ::operator delete(pointer);
+    }
 }
 
 Thread::~Thread() {
     auto &memoryService = Service::getService<MemoryService>();
     memoryService.freeKernelStack(kernelStack);
 
-    delete fpuContext;
+    memoryService.freeKernelMemory(fpuContext, Device::Fpu::CONTEXT_ALIGNMENT);
 
     if (isKernelThread()) {
         delete runnable;
@@ -224,6 +241,22 @@ bool Thread::isKernelThread() const {
     return userStack == nullptr;
 }
 
+uint32_t Thread::getAffinity() const {
+    return affinity;
+}
+
+void Thread::pin() {
+    Util::Async::Atomic<uint32_t>(pinCount).inc();
+}
+
+void Thread::unpin() {
+    Util::Async::Atomic<uint32_t>(pinCount).dec();
+}
+
+bool Thread::isPinned() const {
+    return Util::Async::Atomic<uint32_t>(const_cast<uint32_t&>(pinCount)).get() > 0;
+}
+
 void Thread::join() {
     Service::getService<ProcessService>().getScheduler().join(*this);
 }
@@ -35,10 +35,12 @@ class IdGenerator;
 namespace Kernel {
 
 class Process;
+class WaitQueue;
 
 class Thread {
 
     friend class Scheduler;
+    friend class WaitQueue;
 
 public:
 
@@ -73,6 +75,13 @@ public:
      */
     virtual ~Thread();
 
+    /**
+     * Threads are allocated from an object cache instead of the general kernel heap.
+     */
+    static void* operator new(size_t size);
+
+    static void operator delete(void *pointer, size_t size);
+
     static Thread& createKernelThread(const Util::String &name, Process &parent, Util::Async::Runnable *runnable);
 
     static Thread& createKernelProcessThread(const Util::String &name, Util::Async::Runnable *runnable);
@@ -93,6 +102,23 @@ public:
 
     bool isKernelThread() const;
 
+    /**
+     * Get the CPU affinity mask of this thread (bit n is set, if the thread may run on the CPU with virtual id n).
+     * Use Scheduler::setAffinity() to change it.
+     */
+    uint32_t getAffinity() const;
+
+    /**
+     * Keep the thread from being deleted by the scheduler cleaner, while a pointer to it is used without holding
+     * the lock, that protects it (e.g. by WaitQueue::wake() after removing it from the queue).
+     * Every call must be followed by a call to unpin().
+     */
+    void pin();
+
+    void unpin();
+
+    bool isPinned() const;
+
     void join();
 
     virtual void run();
@@ -135,6 +161,28 @@ private:
 
     uint8_t *fpuContext;
 
+    uint8_t cpuId = 0; // Virtual id of the CPU, whose ready queue this thread belongs to (only changed while holding that queue's lock)
+    bool ready = false; // Set while the thread is running or enqueued in a ready queue
+    bool wakeupPending = false; // Set if the thread has been unblocked while still being runnable
+    bool killed = false;
+
+    uint8_t priorityLevel = 0; // Current level in the multilevel feedback queue (0 is the highest priority)
+    uint8_t usedTicks = 0; // Scheduler ticks used on the current priority level
+    int8_t nice = 0;
+    uint32_t affinity = UINT32_MAX; // Bit n is set, if the thread may run on the CPU with virtual id n
+
+    int32_t sleepIndex = -1; // Index inside the sleep queue of its run queue (-1, if the thread is not sleeping)
+
+    WaitQueue *waitQueue = nullptr; // The wait queue, this thread is currently registered in
+    Thread *nextWaiter = nullptr; // Next thread in the same wait queue
+    uint32_t waitKey = 0;
+
+    uint32_t nextDeferredWakeup = 0; // Next thread in the deferred wakeup list of its run queue
+    uint32_t deferredWakeupQueued = 0; // Set while the thread is part of a deferred wakeup list
+    uint32_t nextIncomingThread = 0; // Next thread in the incoming list of the run queue, this thread is migrated to
+
+    uint32_t pinCount = 0; // Number of references, that prevent the thread from being deleted (see pin())
+
     static Util::Async::IdGenerator idGenerator;
     static const constexpr uint32_t PUSHAD_STACK_SPACE = 8 * 4;
     static const constexpr uint32_t PUSHF_STACK_SPACE = 1 * 4;
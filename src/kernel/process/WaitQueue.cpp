@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "WaitQueue.h"
+
+#include "device/cpu/Cpu.h"
+#include "kernel/process/Scheduler.h"
+#include "kernel/process/Thread.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/Service.h"
+#include "lib/util/async/Lock.h"
+
+namespace Kernel {
+
+void WaitQueue::prepareToWait(uint32_t key) {
+    auto &thread = Service::getService<ProcessService>().getScheduler().getCurrentThread();
+    auto flags = lockQueue();
+
+    if (thread.waitQueue == nullptr) {
+        thread.waitQueue = this;
+        thread.waitKey = key;
+        thread.nextWaiter = nullptr;
+
+        if (tail == nullptr) {
+            head = &thread;
+        } else {
+            tail->nextWaiter = &thread;
+        }
+        tail = &thread;
+    }
+
+    unlockQueue(flags);
+}
+
+void WaitQueue::wait() {
+    Service::getService<ProcessService>().getScheduler().block();
+
+    // The thread may have been woken up by something else (e.g. a pending wakeup) -> Make sure it is not registered anymore
+    cancelWait();
+}
+
+void WaitQueue::wait(const Util::Time::Timestamp &timeout) {
+    Service::getService<ProcessService>().getScheduler().block(timeout);
+    cancelWait();
+}
+
+void WaitQueue::wait(Util::Async::Lock &lock) {
+    prepareToWait();
+    lock.release();
+    wait();
+    lock.acquire();
+}
+
+void WaitQueue::wait(Util::Async::Lock &lock, const Util::Time::Timestamp &timeout) {
+    prepareToWait();
+    lock.release();
+    wait(timeout);
+    lock.acquire();
+}
+
+void WaitQueue::cancelWait() {
+    remove(Service::getService<ProcessService>().getScheduler().getCurrentThread());
+}
+
+uint32_t WaitQueue::wake(uint32_t count, uint32_t key) {
+    auto &scheduler = Service::getService<ProcessService>().getScheduler();
+    uint32_t woken = 0;
+
+    // Threads are unblocked one by one, without holding the queue lock, since unblocking may need to wait for a run queue lock.
+    // The thread is pinned in the meantime, so that it cannot be deleted, if it is killed before being unblocked.
+    while (woken < count) {
+        auto flags = lockQueue();
+
+        auto *thread = head;
+        while (thread != nullptr && thread->waitKey != key) {
+            thread = thread->nextWaiter;
+        }
+
+        if (thread != nullptr) {
+            removeLocked(*thread);
+            thread->pin();
+        }
+
+        unlockQueue(flags);
+
+        if (thread == nullptr) {
+            break;
+        }
+
+        scheduler.unblock(*thread);
+        thread->unpin();
+        woken++;
+    }
+
+    return woken;
+}
+
+uint32_t WaitQueue::wakeAll(uint32_t key) {
+    return wake(UINT32_MAX, key);
+}
+
+void WaitQueue::remove(Thread &thread) {
+    auto flags = lockQueue();
+    if (thread.waitQueue == this) {
+        removeLocked(thread);
+    }
+
+    unlockQueue(flags);
+}
+
+bool WaitQueue::isEmpty() const {
+    return head == nullptr;
+}
+
+uint32_t WaitQueue::lockQueue() {
+    // The queue is also used by interrupt handlers -> Keep interrupts disabled and spin instead of yielding
+    auto flags = Device::Cpu::saveAndDisableInterrupts();
+    while (!queueLock.tryAcquire()) {}
+
+    return flags;
+}
+
+void WaitQueue::unlockQueue(uint32_t interruptFlags) {
+    queueLock.release();
+    Device::Cpu::restoreInterrupts(interruptFlags);
+}
+
+void WaitQueue::removeLocked(Thread &thread) {
+    Thread *previous = nullptr;
+    for (auto *current = head; current != nullptr; previous = current, current = current->nextWaiter) {
+        if (current != &thread) {
+            continue;
+        }
+
+        if (previous == nullptr) {
+            head = current->nextWaiter;
+        } else {
+            previous->nextWaiter = current->nextWaiter;
+        }
+
+        if (tail == current) {
+            tail = previous;
+        }
+
+        break;
+    }
+
+    thread.waitQueue = nullptr;
+    thread.nextWaiter = nullptr;
+}
+
+}
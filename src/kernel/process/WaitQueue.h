@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_WAITQUEUE_H
+#define HHUOS_WAITQUEUE_H
+
+#include <stdint.h>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Util {
+namespace Async {
+class Lock;
+}  // namespace Async
+}  // namespace Util
+
+namespace Kernel {
+
+class Thread;
+
+/**
+ * A queue of threads, which are blocked until another thread (or an interrupt handler) wakes them up.
+ * Waiting threads are removed from the ready queues, so they do not consume any CPU time.
+ *
+ * A wakeup can never get lost, as long as the waiting thread registers itself via prepareToWait(),
+ * before it checks the condition it is waiting for. If the condition is protected by a lock,
+ * wait(lock) does this automatically. Like with condition variables, spurious wakeups are possible,
+ * so the condition must always be checked again after waiting.
+ *
+ * Each waiting thread can be tagged with a key, which allows unrelated conditions to share one queue.
+ * The threads are linked via fields inside the Thread class, so waiting never allocates memory.
+ */
+class WaitQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    WaitQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    WaitQueue(const WaitQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    WaitQueue &operator=(const WaitQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~WaitQueue() = default;
+
+    /**
+     * Register the current thread in this queue. Must be followed by either wait() or cancelWait().
+     * Any wakeup after this call is remembered, even if it arrives before the thread has actually blocked.
+     *
+     * @param key Only wakeups for this key wake up the thread
+     */
+    void prepareToWait(uint32_t key = 0);
+
+    /**
+     * Block the current thread, after it has been registered via prepareToWait().
+     */
+    void wait();
+
+    /**
+     * Block the current thread, after it has been registered via prepareToWait(), for at most the given time.
+     */
+    void wait(const Util::Time::Timestamp &timeout);
+
+    /**
+     * Block the current thread until it is woken up.
+     * The given lock protects the condition, the thread waits for. It must be held by the caller,
+     * is released while the thread is sleeping and acquired again before returning.
+     */
+    void wait(Util::Async::Lock &lock);
+
+    /**
+     * Like wait(lock), but wake up after the given time, if no other thread has woken up the thread before.
+     */
+    void wait(Util::Async::Lock &lock, const Util::Time::Timestamp &timeout);
+
+    /**
+     * Remove the current thread from this queue, after deciding not to wait after all.
+     */
+    void cancelWait();
+
+    /**
+     * Wake up waiting threads in FIFO order. May also be called from interrupt handlers.
+     *
+     * @param count The maximum amount of threads to wake up
+     * @param key Only threads waiting with this key are woken up
+     * @return The amount of threads that have been woken up
+     */
+    uint32_t wake(uint32_t count = 1, uint32_t key = 0);
+
+    /**
+     * Wake up all waiting threads with the given key.
+     */
+    uint32_t wakeAll(uint32_t key = 0);
+
+    /**
+     * Remove the given thread from this queue without waking it up (e.g. because it is being killed).
+     */
+    void remove(Thread &thread);
+
+    [[nodiscard]] bool isEmpty() const;
+
+private:
+
+    uint32_t lockQueue();
+
+    void unlockQueue(uint32_t interruptFlags);
+
+    void removeLocked(Thread &thread);
+
+    Thread *head = nullptr;
+    Thread *tail = nullptr;
+
+    Util::Async::Spinlock queueLock;
+};
+
+}
+
+#endif
@@ -29,6 +29,12 @@
 #include "lib/util/base/Address.h"
 #include "kernel/memory/MemoryLayout.h"
 #include "device/time/rtc/Cmos.h"
+#include "device/cpu/ModelSpecificRegister.h"
+#include "lib/util/hardware/CpuId.h"
+
+extern "C" {
+    void sysenter_entry();
+}
 
 namespace Kernel {
 
@@ -75,6 +81,35 @@ void CpuService::loadGdt() {
     Device::Cpu::writeSegmentRegister(Device::Cpu::ES, Device::Cpu::SegmentSelector(Device::Cpu::Ring0, 2));
     Device::Cpu::writeSegmentRegister(Device::Cpu::FS, Device::Cpu::SegmentSelector(Device::Cpu::Ring0, 2));
     Device::Cpu::writeSegmentRegister(Device::Cpu::GS, Device::Cpu::SegmentSelector(Device::Cpu::Ring0, 2));
+
+    // The SYSENTER stack pointer refers to the TSS, which may have been reallocated
+    enableFastSystemCalls();
+}
+
+bool CpuService::isFastSystemCallAvailable() {
+    if (!Util::Hardware::CpuId::isAvailable()) {
+        return false;
+    }
+
+    const auto info = Util::Hardware::CpuId::getCpuInfo();
+    if ((info.features & Util::Hardware::CpuId::SEP) == 0) {
+        return false;
+    }
+
+    return !(info.family == 6 && info.model < 3 && info.stepping < 3);
+}
+
+void CpuService::enableFastSystemCalls() {
+    if (!isFastSystemCallAvailable()) {
+        return;
+    }
+
+    // SYSENTER uses the kernel code segment (and the next entry as stack segment),
+    // SYSEXIT uses the user code and data segments, which must directly follow in the GDT.
+    auto cpuId = getVirtualCpuId();
+    Device::ModelSpecificRegister(SYSENTER_CS_MSR).writeQuadWord(static_cast<uint16_t>(Device::Cpu::SegmentSelector(Device::Cpu::Ring0, 1)));
+    Device::ModelSpecificRegister(SYSENTER_ESP_MSR).writeQuadWord(reinterpret_cast<uint32_t>(&tss[cpuId].esp0));
+    Device::ModelSpecificRegister(SYSENTER_EIP_MSR).writeQuadWord(reinterpret_cast<uint32_t>(&sysenter_entry));
 }
 
 void CpuService::setTssStackEntry(const uint32_t *stackPointer) {
@@ -53,6 +53,20 @@ public:
 
     void setTssStackEntry(const uint32_t *stackPointer);
 
+    /**
+     * Check if the CPU supports system calls via SYSENTER/SYSEXIT.
+     * Some early Pentium Pro models report support, but do not implement the instructions correctly.
+     */
+    static bool isFastSystemCallAvailable();
+
+    /**
+     * Program the SYSENTER model specific registers of the calling CPU, if fast system calls are available.
+     * SYSENTER loads a fixed stack pointer, which is set to the esp0 field of the CPU's task state segment,
+     * so that the entry code can switch to the kernel stack of the current thread.
+     * This is done by loadGdt() and needs to be called on application processors separately.
+     */
+    void enableFastSystemCalls();
+
     void startupApplicationProcessors();
 
     uint8_t getVirtualCpuId();
@@ -79,6 +93,10 @@ private:
 
     uint8_t* getStack(uint8_t cpuId);
 
+    static const constexpr uint32_t SYSENTER_CS_MSR = 0x174;
+    static const constexpr uint32_t SYSENTER_ESP_MSR = 0x175;
+    static const constexpr uint32_t SYSENTER_EIP_MSR = 0x176;
+
     uint8_t virtualCpuCounter = 0;
     uint8_t virtualCpuIds[256] = {};
     GlobalDescriptorTable *gdt = nullptr;
@@ -24,6 +24,7 @@
 #include "FilesystemService.h"
 #include "filesystem/Node.h"
 #include "kernel/process/FileDescriptorManager.h"
+#include "kernel/memory/VirtualAddressSpace.h"
 #include "kernel/process/Process.h"
 #include "kernel/service/MemoryService.h"
 #include "lib/util/io/file/File.h"
@@ -176,7 +177,7 @@ FilesystemService::FilesystemService() {
         auto length = va_arg(arguments, uint64_t);
         auto &written = *va_arg(arguments, uint64_t*);
 
-        written = filesystemService.getFileDescriptor(fileDescriptor).getNode().writeData(sourceBuffer, pos, length);
+        written = filesystemService.writeFile(fileDescriptor, sourceBuffer, pos, length);
         return true;
     });
 
@@ -192,13 +193,70 @@ FilesystemService::FilesystemService() {
         auto length = va_arg(arguments, uint64_t);
         auto &read = *va_arg(arguments, uint64_t*);
 
-        auto &descriptor = filesystemService.getFileDescriptor(fileDescriptor);
-        if (descriptor.getAccessMode() == Util::Io::File::BLOCKING || descriptor.getNode().isReadyToRead()) {
-            read = descriptor.getNode().readData(targetBuffer, pos, length);
-        } else {
+        // The kernel cannot write to read-only user pages either, so the buffer must be checked beforehand
+        auto &addressSpace = Service::getService<MemoryService>().getCurrentAddressSpace();
+        if (length > UINT32_MAX || !addressSpace.isWritableUserRange(targetBuffer, static_cast<uint32_t>(length))) {
             read = 0;
+            return false;
+        }
+
+        read = filesystemService.readFile(fileDescriptor, targetBuffer, pos, length);
+        return true;
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::WRITE_FILE_VECTOR, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 4) {
+            return false;
+        }
+
+        auto &filesystemService = Service::getService<FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto *vectors = va_arg(arguments, const Util::Io::File::IoVector*);
+        auto count = va_arg(arguments, size_t);
+        auto &written = *va_arg(arguments, uint64_t*);
+
+        written = filesystemService.writeFileVector(fileDescriptor, vectors, count);
+        return true;
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::READ_FILE_VECTOR, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 4) {
+            return false;
+        }
+
+        auto &filesystemService = Service::getService<FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto *vectors = va_arg(arguments, const Util::Io::File::IoVector*);
+        auto count = va_arg(arguments, size_t);
+        auto &read = *va_arg(arguments, uint64_t*);
+
+        // The kernel cannot write to read-only user pages either, so the buffers must be checked beforehand
+        auto &addressSpace = Service::getService<MemoryService>().getCurrentAddressSpace();
+        for (size_t i = 0; i < count; i++) {
+            if (vectors[i].length > UINT32_MAX || !addressSpace.isWritableUserRange(vectors[i].buffer, static_cast<uint32_t>(vectors[i].length))) {
+                read = 0;
+                return false;
+            }
         }
 
+        read = filesystemService.readFileVector(fileDescriptor, vectors, count);
+        return true;
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::COPY_FILE_RANGE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 6) {
+            return false;
+        }
+
+        auto &filesystemService = Service::getService<FilesystemService>();
+        auto sourceFileDescriptor = va_arg(arguments, int32_t);
+        auto sourcePos = va_arg(arguments, uint64_t);
+        auto targetFileDescriptor = va_arg(arguments, int32_t);
+        auto targetPos = va_arg(arguments, uint64_t);
+        auto length = va_arg(arguments, uint64_t);
+        auto &copied = *va_arg(arguments, uint64_t*);
+
+        copied = filesystemService.copyFileRange(sourceFileDescriptor, sourcePos, targetFileDescriptor, targetPos, length);
         return true;
     });
 
@@ -295,6 +353,42 @@ void FilesystemService::closeFile(int32_t fileDescriptor) {
     return Service::getService<ProcessService>().getCurrentProcess().getFileDescriptorManager().closeFile(fileDescriptor);
 }
 
+uint64_t FilesystemService::readFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t pos, uint64_t length) {
+    auto &descriptor = getFileDescriptor(fileDescriptor);
+    if (descriptor.getAccessMode() == Util::Io::File::BLOCKING || descriptor.getNode().isReadyToRead()) {
+        return descriptor.getNode().readData(targetBuffer, pos, length);
+    }
+
+    return 0;
+}
+
+uint64_t FilesystemService::writeFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t pos, uint64_t length) {
+    return getFileDescriptor(fileDescriptor).getNode().writeData(sourceBuffer, pos, length);
+}
+
+uint64_t FilesystemService::readFileVector(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, size_t count) {
+    auto &descriptor = getFileDescriptor(fileDescriptor);
+    if (descriptor.getAccessMode() == Util::Io::File::BLOCKING || descriptor.getNode().isReadyToRead()) {
+        return descriptor.getNode().readDataVector(vectors, count);
+    }
+
+    return 0;
+}
+
+uint64_t FilesystemService::writeFileVector(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, size_t count) {
+    return getFileDescriptor(fileDescriptor).getNode().writeDataVector(vectors, count);
+}
+
+uint64_t FilesystemService::copyFileRange(int32_t sourceFileDescriptor, uint64_t sourcePos, int32_t targetFileDescriptor, uint64_t targetPos, uint64_t length) {
+    auto &source = getFileDescriptor(sourceFileDescriptor);
+    auto &target = getFileDescriptor(targetFileDescriptor);
+    if (source.getAccessMode() == Util::Io::File::BLOCKING || source.getNode().isReadyToRead()) {
+        return source.getNode().copyData(target.getNode(), sourcePos, targetPos, length);
+    }
+
+    return 0;
+}
+
 FileDescriptor& FilesystemService::getFileDescriptor(int32_t fileDescriptor) {
     return Service::getService<ProcessService>().getCurrentProcess().getFileDescriptorManager().getDescriptor(fileDescriptor);
 }
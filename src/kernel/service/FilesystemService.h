@@ -27,6 +27,7 @@
 #include "Service.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/base/String.h"
+#include "lib/util/io/file/File.h"
 
 namespace Filesystem {
 class Node;
@@ -76,6 +77,16 @@ public:
 
     void closeFile(int32_t fileDescriptor);
 
+    uint64_t readFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t pos, uint64_t length);
+
+    uint64_t writeFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t pos, uint64_t length);
+
+    uint64_t readFileVector(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, size_t count);
+
+    uint64_t writeFileVector(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, size_t count);
+
+    uint64_t copyFileRange(int32_t sourceFileDescriptor, uint64_t sourcePos, int32_t targetFileDescriptor, uint64_t targetPos, uint64_t length);
+
     FileDescriptor& getFileDescriptor(int32_t fileDescriptor);
 
     Filesystem::Filesystem& getFilesystem();
@@ -97,6 +97,17 @@ void InterruptService::dispatchSystemCall(Util::System::Code code, uint16_t para
     systemCallDispatcher.dispatch(code, paramCount, params, result);
 }
 
+// Called by 'sysenter_entry' (see sysenter.asm) with the arguments, that have been passed in registers.
+// System calls via 'int 0x86' are decoded by InterruptDescriptorTable::handleSystemCall() instead.
+extern "C" bool dispatch_fast_system_call(uint32_t codeAndParamCount, va_list arguments) {
+    bool result;
+    auto code = static_cast<Util::System::Code>(codeAndParamCount);
+    auto paramCount = codeAndParamCount >> 8;
+
+    Service::getService<InterruptService>().dispatchSystemCall(code, paramCount, arguments, result);
+    return result;
+}
+
 void InterruptService::allowHardwareInterrupt(Device::InterruptRequest interrupt) {
     if (usesApic()) {
         apic->allow(interrupt);
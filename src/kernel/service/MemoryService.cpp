@@ -34,20 +34,37 @@
 #include "lib/util/base/HeapMemoryManager.h"
 #include "lib/util/base/System.h"
 #include "device/cpu/Cpu.h"
+#include "device/cpu/PageAttributeTable.h"
 #include "kernel/service/Service.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/base/Constants.h"
 #include "device/system/Bios.h"
 #include "kernel/process/Process.h"
+#include "kernel/log/Log.h"
+#include "kernel/memory/FileMapping.h"
+#include "kernel/interrupt/InterruptFrame.h"
+#include "kernel/service/FilesystemService.h"
+#include "kernel/service/TimeService.h"
+#include "kernel/service/CpuService.h"
+#include "device/interrupt/apic/LocalApic.h"
+#include "lib/util/async/Atomic.h"
+#include "filesystem/Filesystem.h"
+#include "filesystem/Node.h"
+#include "lib/util/io/file/File.h"
 
 namespace Kernel {
 
 MemoryService::MemoryService(PageFrameAllocator *pageFrameAllocator, PagingAreaManager *pagingAreaManager, VirtualAddressSpace *kernelAddressSpace) :
-        pageFrameAllocator(*pageFrameAllocator), pagingAreaManager(*pagingAreaManager), pageFrameSlabAllocator(reinterpret_cast<uint8_t*>(allocatePhysicalMemory(SlabAllocator::MAX_SLAB_SIZE / Util::PAGESIZE))),
+        pageFrameAllocator(*pageFrameAllocator), pagingAreaManager(*pagingAreaManager),
         kernelStackAllocator(reinterpret_cast<uint8_t*>(MemoryLayout::KERNEL_STACK_AREA.startAddress), reinterpret_cast<uint8_t*>(MemoryLayout::KERNEL_STACK_AREA.endAddress), MemoryLayout::KERNEL_STACK_SIZE),
-        currentAddressSpace(kernelAddressSpace), kernelAddressSpace(*kernelAddressSpace) {
+        kernelAddressSpace(*kernelAddressSpace), zeroedFramePool(ZEROED_FRAME_POOL_SIZE) {
     addressSpaces.add(kernelAddressSpace);
 
+    // All processors start in the kernel address space
+    for (auto &addressSpace : currentAddressSpaces) {
+        addressSpace = kernelAddressSpace;
+    }
+
     Service::getService<InterruptService>().assignSystemCall(Util::System::UNMAP, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 2) {
             return false;
@@ -66,21 +83,50 @@ MemoryService::MemoryService(PageFrameAllocator *pageFrameAllocator, PagingAreaM
     });
 
     Service::getService<InterruptService>().assignSystemCall(Util::System::MAP_IO, [](uint32_t paramCount, va_list arguments) -> bool {
-        if (paramCount < 3) {
+        if (paramCount < 4) {
             return false;
         }
 
         auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
         auto physicalAddress = va_arg(arguments, uint32_t);
         auto pageCount = va_arg(arguments, uint32_t);
+        auto writeCombining = va_arg(arguments, uint32_t);
         void *&mappedAddress = *va_arg(arguments, void**);
 
-        mappedAddress = memoryService.mapIO(reinterpret_cast<void*>(physicalAddress), pageCount, false);
+        mappedAddress = memoryService.mapIO(reinterpret_cast<void*>(physicalAddress), pageCount, false, writeCombining);
         return true;
     });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::MAP_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 5) {
+            return false;
+        }
+
+        auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
+        auto *path = va_arg(arguments, const char*);
+        auto offset = va_arg(arguments, uint64_t);
+        auto length = va_arg(arguments, uint32_t);
+        auto readOnly = va_arg(arguments, uint32_t);
+        void *&mappedAddress = *va_arg(arguments, void**);
+
+        mappedAddress = memoryService.mapFile(path, offset, length, readOnly);
+        return mappedAddress != nullptr;
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::UNMAP_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 1) {
+            return false;
+        }
+
+        auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
+        auto *virtualAddress = va_arg(arguments, void*);
+
+        return memoryService.unmapFile(virtualAddress);
+    });
 }
 
 MemoryService::~MemoryService() {
+    delete pageFrameBuddyAllocator;
     delete &pageFrameAllocator;
     delete &pagingAreaManager;
 
@@ -102,15 +148,15 @@ void MemoryService::freeKernelMemory(void *pointer, uint32_t alignment) {
 }
 
 void *MemoryService::allocateUserMemory(uint32_t size, uint32_t alignment) {
-    return currentAddressSpace->getMemoryManager().allocateMemory(size, alignment);
+    return getCurrentAddressSpace().getMemoryManager().allocateMemory(size, alignment);
 }
 
 void *MemoryService::reallocateUserMemory(void *pointer, uint32_t size, uint32_t alignment) {
-    return currentAddressSpace->getMemoryManager().reallocateMemory(pointer, size, alignment);
+    return getCurrentAddressSpace().getMemoryManager().reallocateMemory(pointer, size, alignment);
 }
 
 void MemoryService::freeUserMemory(void *pointer, uint32_t alignment) {
-    currentAddressSpace->getMemoryManager().freeMemory(pointer, alignment);
+    getCurrentAddressSpace().getMemoryManager().freeMemory(pointer, alignment);
 }
 
 void* MemoryService::allocateBiosMemory(uint32_t pageCount) {
@@ -136,7 +182,7 @@ void* MemoryService::allocateBiosMemory(uint32_t pageCount) {
         // This can happen because the headers of the free list are mapped to arbitrary physical addresses, but the memory should be mapped to the given physical addresses.
         unmap(currentVirtualAddress, 1);
         // Map the page into the current address space
-        currentAddressSpace->map(currentPhysicalAddress, currentVirtualAddress, flags);
+        getCurrentAddressSpace().map(currentPhysicalAddress, currentVirtualAddress, flags);
     }
 
     return virtualAddress;
@@ -157,6 +203,7 @@ void* MemoryService::allocateIsaMemory(uint32_t pageCount) {
     // Create mapping
     uint32_t flags = Paging::PRESENT | Paging::WRITABLE | Paging::CACHE_DISABLE;
 
+    auto &addressSpace = getCurrentAddressSpace();
     for (uint32_t i = 0; i < pageCount; i++) {
         void *currentPhysicalAddress = reinterpret_cast<uint8_t*>(physicalAddress) + i * Util::PAGESIZE;
         void *currentVirtualAddress = reinterpret_cast<uint8_t*>(virtualAddress) + i * Util::PAGESIZE;
@@ -165,15 +212,15 @@ void* MemoryService::allocateIsaMemory(uint32_t pageCount) {
         // This can happen because the headers of the free list are mapped to arbitrary physical addresses, but the memory should be mapped to the given physical addresses.
         unmap(currentVirtualAddress, 1);
         // Map the page into the current address space
-        currentAddressSpace->map(currentPhysicalAddress, currentVirtualAddress, flags);
+        addressSpace.map(currentPhysicalAddress, currentVirtualAddress, flags);
     }
 
     return virtualAddress;
 }
 
 void* MemoryService::allocatePhysicalMemory(uint32_t frameCount, void *startAddress) {
-    if (slabAllocatorEnabled && reinterpret_cast<uint32_t>(startAddress) >= Device::Isa::MAX_DMA_ADDRESS) {
-        void *physicalStartAddress = pageFrameSlabAllocator.allocateBlock(frameCount);
+    if (pageFrameBuddyAllocator != nullptr && reinterpret_cast<uint32_t>(startAddress) >= Device::Isa::MAX_DMA_ADDRESS) {
+        void *physicalStartAddress = pageFrameBuddyAllocator->allocateBlock(frameCount);
         if (physicalStartAddress != nullptr) {
             return physicalStartAddress;
         }
@@ -209,7 +256,28 @@ void* MemoryService::allocatePhysicalMemory(uint32_t frameCount, void *startAddr
 }
 
 void MemoryService::freePhysicalMemory(void *pointer, uint32_t frameCount) {
-    if (slabAllocatorEnabled && pageFrameSlabAllocator.freeBlock(pointer)) {
+    if (pageFrameBuddyAllocator != nullptr && pointer >= pageFrameBuddyAllocator->getStartAddress() && pointer <= pageFrameBuddyAllocator->getEndAddress()) {
+        // Frames of the buddy allocator keep a use count of 1 in the page frame allocator, while they are reserved for it.
+        // Frames, that have been referenced additionally (e.g. shared with a cloned address space or a file mapping),
+        // are only dereferenced. All other frames are given back to the buddy allocator in contiguous runs.
+        auto *frames = static_cast<uint8_t*>(pointer);
+        uint32_t runStart = 0;
+        for (uint32_t i = 0; i <= frameCount; i++) {
+            if (i < frameCount && pageFrameAllocator.getUseCount(frames + i * Util::PAGESIZE) <= 1) {
+                continue;
+            }
+
+            if (i > runStart) {
+                pageFrameBuddyAllocator->freeBlock(frames + runStart * Util::PAGESIZE, i - runStart);
+            }
+
+            if (i < frameCount) {
+                pageFrameAllocator.freeBlock(frames + i * Util::PAGESIZE);
+            }
+
+            runStart = i + 1;
+        }
+
         return;
     }
 
@@ -235,21 +303,25 @@ Paging::Table* MemoryService::allocatePageTable() {
 }
 
 void MemoryService::freePageTable(Paging::Table *pageTable) {
-    void *physicalAddress = currentAddressSpace->unmap(pageTable);
+    auto &addressSpace = getCurrentAddressSpace();
+    void *physicalAddress = addressSpace.unmap(pageTable);
     if (physicalAddress == nullptr) {
         return;
     }
 
+    invalidateTlbEntries(addressSpace, pageTable, 1);
+
     // Free virtual memory
     pagingAreaManager.freeBlock(pageTable);
 }
 
 void Kernel::MemoryService::map(void *virtualAddress, uint32_t pageCount, uint16_t flags, bool abortIfLocked) {
+    auto &addressSpace = getCurrentAddressSpace();
     for (uint32_t i = 0; i < pageCount; i++) {
         // Allocate a physical page frames to where the page should be mapped
         auto *physicalAddress = pageFrameAllocator.allocateBlock();
         // Map the frame to given virtual address
-        currentAddressSpace->map(physicalAddress, reinterpret_cast<uint8_t*>(virtualAddress) + i * Util::PAGESIZE, flags, abortIfLocked);
+        addressSpace.map(physicalAddress, reinterpret_cast<uint8_t*>(virtualAddress) + i * Util::PAGESIZE, flags, abortIfLocked);
     }
 }
 
@@ -259,18 +331,46 @@ void* Kernel::MemoryService::unmap(void *virtualAddress, uint32_t pageCount, uin
         Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "MemoryService: unmap() called with unaligned virtual address!");
     }
 
-    // Loop through pages and unmap them individually
+    // Loop through pages and unmap them individually.
+    // Other CPUs may still access the unmapped frames through their TLBs, so the frames are collected and only freed after a TLB shootdown.
     void *physicalAddress = nullptr;
+    void *unmappedFrames[MAX_TLB_SHOOTDOWN_PAGES];
+    uint32_t unmappedFrameCount = 0;
+    uint32_t unmappedRangeStart = 0;
+    uint32_t unmappedRangeEnd = 0;
     uint8_t nonMappedCount = 0;
+    auto &addressSpace = getCurrentAddressSpace();
     for (uint32_t i = 0; i < pageCount; i++) {
         auto currentVirtualAddress = reinterpret_cast<uint32_t>(virtualAddress) + (i * Util::PAGESIZE);
-        physicalAddress = currentAddressSpace->unmap(reinterpret_cast<const void*>(currentVirtualAddress));
+
+        // Large pages are unmapped as a whole and do not belong to the page frame allocator
+        if (addressSpace.isLargePage(reinterpret_cast<const void*>(currentVirtualAddress))) {
+            physicalAddress = addressSpace.unmap(reinterpret_cast<const void*>(currentVirtualAddress));
+            invalidateTlbEntries(addressSpace, reinterpret_cast<const void*>(currentVirtualAddress), 1);
+            nonMappedCount = 0;
+
+            // Skip the remaining pages of the large page
+            i += (Paging::LARGE_PAGE_SIZE - currentVirtualAddress % Paging::LARGE_PAGE_SIZE) / Util::PAGESIZE - 1;
+            continue;
+        }
+
+        physicalAddress = addressSpace.unmap(reinterpret_cast<const void*>(currentVirtualAddress));
 
         if (physicalAddress == nullptr) {
             nonMappedCount++;
         } else {
             nonMappedCount = 0;
-            freePhysicalMemory(physicalAddress, 1);
+
+            if (unmappedFrameCount == 0) {
+                unmappedRangeStart = currentVirtualAddress;
+            }
+
+            unmappedRangeEnd = currentVirtualAddress + Util::PAGESIZE;
+            unmappedFrames[unmappedFrameCount++] = physicalAddress;
+            if (unmappedFrameCount == MAX_TLB_SHOOTDOWN_PAGES) {
+                freeUnmappedFrames(addressSpace, unmappedRangeStart, unmappedRangeEnd, unmappedFrames, unmappedFrameCount);
+                unmappedFrameCount = 0;
+            }
         }
 
         // TODO: This is ugly! We need a proper management for mapped/unmapped pages
@@ -282,10 +382,22 @@ void* Kernel::MemoryService::unmap(void *virtualAddress, uint32_t pageCount, uin
         }
     }
 
+    if (unmappedFrameCount > 0) {
+        freeUnmappedFrames(addressSpace, unmappedRangeStart, unmappedRangeEnd, unmappedFrames, unmappedFrameCount);
+    }
+
     return physicalAddress;
 }
 
+void MemoryService::freeUnmappedFrames(const VirtualAddressSpace &addressSpace, uint32_t startAddress, uint32_t endAddress, void **frames, uint32_t frameCount) {
+    invalidateTlbEntries(addressSpace, reinterpret_cast<const void*>(startAddress), (endAddress - startAddress) / Util::PAGESIZE);
+    for (uint32_t i = 0; i < frameCount; i++) {
+        freePhysicalMemory(frames[i], 1);
+    }
+}
+
 void Kernel::MemoryService::mapPhysical(void *physicalAddress, void *virtualAddress, uint32_t pageCount, uint16_t flags) {
+    auto &addressSpace = getCurrentAddressSpace();
     for (uint32_t i = 0; i < pageCount; i++) {
         void *currentPhysicalAddress = reinterpret_cast<uint8_t*>(physicalAddress) + i * Util::PAGESIZE;
         void *currentVirtualAddress = reinterpret_cast<uint8_t*>(virtualAddress) + i * Util::PAGESIZE;
@@ -296,7 +408,7 @@ void Kernel::MemoryService::mapPhysical(void *physicalAddress, void *virtualAddr
         // Mark the physical page frame as used
         currentPhysicalAddress = pageFrameAllocator.allocateBlockAtAddress(currentPhysicalAddress);
         // Map the page into the current address space
-        currentAddressSpace->map(currentPhysicalAddress, currentVirtualAddress, flags);
+        addressSpace.map(currentPhysicalAddress, currentVirtualAddress, flags);
     }
 }
 
@@ -304,11 +416,12 @@ void *MemoryService::mapIO(uint32_t pageCount, bool mapToKernelHeap) {
     // Allocate block of physical memory
     void *physicalAddress = allocatePhysicalMemory(pageCount);
     // Allocate a block of page aligned virtual memory in the heap
-    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : currentAddressSpace->getMemoryManager();
+    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : getCurrentAddressSpace().getMemoryManager();
     void *virtualAddress = manager.allocateMemory(pageCount * Util::PAGESIZE, Util::PAGESIZE);
 
     // Create mapping
     uint32_t flags = Paging::PRESENT | Paging::WRITABLE | Paging::CACHE_DISABLE | (reinterpret_cast<uint32_t>(virtualAddress) >= Kernel::MemoryLayout::KERNEL_END ? Paging::USER_ACCESSIBLE : Paging::NONE);
+    auto &addressSpace = getCurrentAddressSpace();
     for (uint32_t i = 0; i < pageCount; i++) {
         void *currentPhysicalAddress = reinterpret_cast<uint8_t*>(physicalAddress) + i * Util::PAGESIZE;
         void *currentVirtualAddress = reinterpret_cast<uint8_t*>(virtualAddress) + i * Util::PAGESIZE;
@@ -317,7 +430,7 @@ void *MemoryService::mapIO(uint32_t pageCount, bool mapToKernelHeap) {
         // This can happen because the headers of the free list are mapped to arbitrary physical addresses, but the memory should be mapped to the given physical addresses.
         unmap(currentVirtualAddress, 1);
         // Map the page into the current address space
-        currentAddressSpace->map(currentPhysicalAddress, currentVirtualAddress, flags);
+        addressSpace.map(currentPhysicalAddress, currentVirtualAddress, flags);
     }
 
     return virtualAddress;
@@ -345,55 +458,175 @@ bool MemoryService::mapSharedMemory(uint32_t sourceProcessId, const Util::String
         const auto virtualTargetAddress = static_cast<uint8_t*>(virtualAddress) + i * Util::PAGESIZE;
         unmap(virtualTargetAddress, 1);
 
-        currentAddressSpace->map(physicalSharedAddress, virtualTargetAddress, Paging::PRESENT | Paging::WRITABLE | Paging::USER_ACCESSIBLE);
+        getCurrentAddressSpace().map(physicalSharedAddress, virtualTargetAddress, Paging::PRESENT | Paging::WRITABLE | Paging::USER_ACCESSIBLE);
+    }
+
+    return true;
+}
+
+void* MemoryService::mapFile(const Util::String &path, uint64_t offset, uint32_t length, bool readOnly) {
+    // Page faults are only resolved by file mappings inside a user space heap
+    if (getCurrentAddressSpace().isKernelAddressSpace() || offset % Util::PAGESIZE != 0) {
+        return nullptr;
+    }
+
+    auto canonicalPath = Util::Io::File::getCanonicalPath(path);
+    auto *node = getService<FilesystemService>().getFilesystem().getNode(canonicalPath);
+    if (node == nullptr) {
+        return nullptr;
+    }
+
+    const auto fileLength = node->getLength();
+    if (node->getType() != Util::Io::File::REGULAR || offset >= fileLength) {
+        delete node;
+        return nullptr;
+    }
+
+    if (length == 0) {
+        length = fileLength - offset;
+    }
+
+    const auto pageCount = (length + Util::PAGESIZE - 1) / Util::PAGESIZE;
+
+    // Read-only mappings of the same file range share their page frames
+    FileMapping *mapping = nullptr;
+    if (readOnly) {
+        fileMappingLock.acquire();
+        for (auto *sharedMapping : sharedFileMappings) {
+            if (sharedMapping->matches(canonicalPath, offset, pageCount, readOnly)) {
+                sharedMapping->acquire();
+                mapping = sharedMapping;
+                break;
+            }
+        }
+
+        if (mapping == nullptr) {
+            mapping = new FileMapping(node, canonicalPath, offset, pageCount, readOnly);
+            sharedFileMappings.add(mapping);
+            node = nullptr;
+        }
+
+        fileMappingLock.release();
+        delete node;
+    } else {
+        mapping = new FileMapping(node, canonicalPath, offset, pageCount, readOnly);
+    }
+
+    // Allocate page aligned virtual memory
+    auto *virtualAddress = allocateUserMemory(pageCount * Util::PAGESIZE, Util::PAGESIZE);
+    if (virtualAddress == nullptr) {
+        releaseFileMapping(*mapping);
+        return nullptr;
+    }
+
+    // Register the mapping before clearing the range, so that no page fault maps anonymous memory into it anymore.
+    // Some pages may already be mapped, because the headers of the free list are mapped to arbitrary physical addresses.
+    getCurrentAddressSpace().addFileMapping(virtualAddress, pageCount, *mapping);
+    unmap(virtualAddress, pageCount);
+
+    return virtualAddress;
+}
+
+bool MemoryService::unmapFile(void *virtualAddress) {
+    FileMappingRegion region{};
+    if (!getCurrentAddressSpace().removeFileMapping(virtualAddress, region)) {
+        return false;
     }
 
+    // Drop the address space's references to the loaded page frames and give the virtual memory back to the heap
+    unmap(virtualAddress, region.pageCount);
+    freeUserMemory(virtualAddress, Util::PAGESIZE);
+    releaseFileMapping(*region.mapping);
+
     return true;
 }
 
-void *Kernel::MemoryService::mapIO(void *physicalAddress, uint32_t pageCount, bool mapToKernelHeap) {
+void MemoryService::releaseFileMapping(FileMapping &mapping) {
+    if (!mapping.release()) {
+        return;
+    }
+
+    if (mapping.isReadOnly()) {
+        fileMappingLock.acquire();
+        sharedFileMappings.remove(&mapping);
+        fileMappingLock.release();
+    }
+
+    delete &mapping;
+}
+
+void *Kernel::MemoryService::mapIO(void *physicalAddress, uint32_t pageCount, bool mapToKernelHeap, bool writeCombining) {
+    // Large device memory regions (e.g. a linear frame buffer) in user space are mapped with 4 MiB pages, if possible.
+    // The kernel area is not suitable, since its page tables are shared by all address spaces.
+    const auto useLargePages = !mapToKernelHeap && !getCurrentAddressSpace().isKernelAddressSpace() && isLargePageMappingPossible(physicalAddress, pageCount);
+
     // Allocate page aligned virtual memory
-    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : currentAddressSpace->getMemoryManager();
-    void *virtualAddress = manager.allocateMemory(pageCount * Util::PAGESIZE, Util::PAGESIZE);
+    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : getCurrentAddressSpace().getMemoryManager();
+    void *virtualAddress = manager.allocateMemory(pageCount * Util::PAGESIZE, useLargePages ? Paging::LARGE_PAGE_SIZE : Util::PAGESIZE);
 
     // Create mapping
-    uint32_t flags = Paging::PRESENT | Paging::WRITABLE | Paging::CACHE_DISABLE | (reinterpret_cast<uint32_t>(virtualAddress) >= Kernel::MemoryLayout::KERNEL_END ? Paging::USER_ACCESSIBLE : Paging::NONE);
+    const auto memoryType = writeCombining && Device::PageAttributeTable::isWriteCombiningEnabled() ? Paging::WRITE_COMBINING : Paging::CACHE_DISABLE;
+    uint32_t flags = Paging::PRESENT | Paging::WRITABLE | memoryType | (reinterpret_cast<uint32_t>(virtualAddress) >= Kernel::MemoryLayout::KERNEL_END ? Paging::USER_ACCESSIBLE : Paging::NONE);
+    auto &addressSpace = getCurrentAddressSpace();
     for (uint32_t i = 0; i < pageCount; i++) {
         void *currentPhysicalAddress = reinterpret_cast<uint8_t*>(physicalAddress) + i * Util::PAGESIZE;
         void *currentVirtualAddress = reinterpret_cast<uint8_t*>(virtualAddress) + i * Util::PAGESIZE;
 
+        // Map a whole large page, if enough pages are left (falling back to regular pages, if a page table is already present)
+        if (useLargePages && i % Paging::ENTRIES_PER_TABLE == 0 && pageCount - i >= Paging::ENTRIES_PER_TABLE) {
+            unmap(currentVirtualAddress, Paging::ENTRIES_PER_TABLE);
+            if (addressSpace.mapLargePage(currentPhysicalAddress, currentVirtualAddress, flags)) {
+                i += Paging::ENTRIES_PER_TABLE - 1;
+                continue;
+            }
+        }
+
         // If the virtual address is already mapped, we have to unmap it.
         // This can happen because the headers of the free list are mapped to arbitrary physical addresses, but the memory should be mapped to the given physical addresses.
         unmap(currentVirtualAddress, 1);
         // Mark the physical page frame as used
         currentPhysicalAddress = pageFrameAllocator.allocateBlockAtAddress(currentPhysicalAddress);
         // Map the page into the current address space
-        currentAddressSpace->map(currentPhysicalAddress, currentVirtualAddress, flags);
+        addressSpace.map(currentPhysicalAddress, currentVirtualAddress, flags);
     }
 
     return virtualAddress;
 }
 
+bool MemoryService::isLargePageMappingPossible(void *physicalAddress, uint32_t pageCount) const {
+    // Large pages are not reference counted, so they may only map memory outside the page frame allocator's range
+    return (Device::Cpu::readCr4() & Device::Cpu::PAGE_SIZE_EXTENSIONS) != 0 && pageCount >= Paging::ENTRIES_PER_TABLE &&
+            reinterpret_cast<uint32_t>(physicalAddress) % Paging::LARGE_PAGE_SIZE == 0 && physicalAddress > pageFrameAllocator.getEndAddress();
+}
+
 void* MemoryService::getPhysicalAddress(void *virtualAddress) {
-    return currentAddressSpace->getPhysicalAddress(virtualAddress);
+    return getCurrentAddressSpace().getPhysicalAddress(virtualAddress);
 }
 
 VirtualAddressSpace& MemoryService::createAddressSpace() {
     auto addressSpace = new VirtualAddressSpace();
     addressSpaces.add(addressSpace);
 
+    // Every user space gets read-only access to the system time, without performing a system call
+    if (Service::isServiceRegistered(TimeService::SERVICE_ID)) {
+        Service::getService<TimeService>().mapTimePage(*addressSpace);
+    }
+
     return *addressSpace;
 }
 
 void MemoryService::switchAddressSpace(VirtualAddressSpace &addressSpace) {
+    const auto interruptFlags = Device::Cpu::saveAndDisableInterrupts();
+    auto &currentAddressSpace = currentAddressSpaces[getCurrentCpuId()];
     if (currentAddressSpace == &addressSpace) {
+        Device::Cpu::restoreInterrupts(interruptFlags);
         return;
     }
 
     // Get physical address of new page directory
-    auto *pageDirectoryPhysical = getPhysicalAddress(const_cast<void*>(reinterpret_cast<const void*>(&addressSpace.getPageDirectoryPhysical())));
+    auto *pageDirectoryPhysical = currentAddressSpace->getPhysicalAddress(const_cast<void*>(reinterpret_cast<const void*>(&addressSpace.getPageDirectoryPhysical())));
 
-    // Set current address space
+    // Set current address space of this processor
     currentAddressSpace = &addressSpace;
 
     asm volatile (
@@ -401,20 +634,39 @@ void MemoryService::switchAddressSpace(VirtualAddressSpace &addressSpace) {
             : :
             "r"(pageDirectoryPhysical)
             );
+
+    Device::Cpu::restoreInterrupts(interruptFlags);
 }
 
 void MemoryService::removeAddressSpace(VirtualAddressSpace &addressSpace) {
-    if (currentAddressSpace == &addressSpace) {
-        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "MemoryService: Trying to delete the currently active address space!");
+    for (const auto *currentAddressSpace : currentAddressSpaces) {
+        if (currentAddressSpace == &addressSpace) {
+            Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "MemoryService: Trying to delete an active address space!");
+        }
     }
 
     addressSpaces.remove(&addressSpace);
     delete &addressSpace;
 }
 
-void MemoryService::handlePageFault(uint32_t errorCode) {
+void MemoryService::handlePageFault(const InterruptFrame &frame, uint32_t errorCode) {
     // The faulted linear address is stored in the cr2 register
     const auto faultAddress = Device::Cpu::readCr2();
+    const auto alignedFaultAddress = Util::Address(faultAddress).alignDown(Util::PAGESIZE).get();
+
+    // Check if page fault was caused by a write access to a copy-on-write page
+    if ((errorCode & 0x00000003u) == 0x00000003u && getCurrentAddressSpace().isCopyOnWrite(reinterpret_cast<void*>(alignedFaultAddress))) {
+        // Copying the page needs the kernel heap, which is only safe if the faulting code could be interrupted
+        if ((frame.flags & Device::Cpu::INTERRUPT_FLAG) == 0) {
+            Util::Panic::fire(Util::Panic::PAGING_ERROR, "Write to copy-on-write page with interrupts disabled!");
+        }
+
+        asm volatile ("sti");
+        handleCopyOnWriteFault(alignedFaultAddress);
+        asm volatile ("cli");
+
+        return;
+    }
 
     // Check if page fault was caused by an illegal page access
     if ((errorCode & 0x00000001u) > 0) {
@@ -426,24 +678,258 @@ void MemoryService::handlePageFault(uint32_t errorCode) {
          Util::Panic::fire(Util::Panic::PAGING_ERROR, "Privilege level not sufficient to access page!");
     }
 
-    // Page fault was caused by a non-present page
-    const auto alignedFaultAddress = Util::Address(faultAddress).alignDown(Util::PAGESIZE).get();
-
-    // Check if the faulted address is inside a user space stack
+    // Page fault was caused by a non-present page -> Check if the faulted address is inside a user space stack
     // If the fault occurs right at the start of a user space stack, a stack overflow happened
     if (faultAddress >= Util::USER_SPACE_STACK_MEMORY_START_ADDRESS && alignedFaultAddress % Util::MAX_USER_STACK_SIZE == 0) {
         Util::Panic::fire(Util::Panic::STACK_OVERFLOW, "Page fault below user space stack!");
     }
 
-    // Map the faulted Page
+    // Faults in a user space heap map a whole aligned window of pages at once, to reduce the number of faults
+    // when a large buffer is accessed sequentially. Other faults (kernel heap, user stacks) only map a single page.
     const auto userSpace = faultAddress >= MemoryLayout::KERNEL_AREA.endAddress;
-    map(reinterpret_cast<void*>(faultAddress), 1, Paging::PRESENT | Paging::WRITABLE | (userSpace ? Paging::USER_ACCESSIBLE : Paging::NONE), true);
+    const auto userHeap = userSpace && faultAddress < Util::USER_SPACE_STACK_MEMORY_START_ADDRESS;
+    auto pageCount = userHeap ? faultAroundPages : 1;
+    auto windowAddress = Util::Address(faultAddress).alignDown(pageCount * Util::PAGESIZE).get();
+
+    // File mappings live inside the user space heap. Their pages are read from the file instead of being zeroed,
+    // and the fault-around window of anonymous memory must not reach into them.
+    if (userHeap) {
+        FileMappingRegion region{};
+        bool locked = false;
+        if (getCurrentAddressSpace().findFileMapping(reinterpret_cast<void*>(windowAddress), pageCount, reinterpret_cast<void*>(alignedFaultAddress), region, locked)) {
+            if (region.overlaps(alignedFaultAddress, 1)) {
+                // Reading the file may block, which is only possible if the faulting code could be interrupted
+                if ((frame.flags & Device::Cpu::INTERRUPT_FLAG) == 0) {
+                    Util::Panic::fire(Util::Panic::PAGING_ERROR, "Page fault in file mapping with interrupts disabled!");
+                }
+
+                asm volatile ("sti");
+                handleFileMappingFault(region, alignedFaultAddress);
+                releaseFileMapping(*region.mapping);
+                asm volatile ("cli");
+
+                return;
+            }
+
+            pageCount = 1;
+            windowAddress = alignedFaultAddress;
+        } else if (locked) {
+            // The list of file mappings is currently modified and the access will fault again
+            return;
+        }
+    }
+
+    // Map the window to frames that have preferably already been zeroed in the background
+    const auto flags = Paging::PRESENT | Paging::WRITABLE | (userSpace ? Paging::USER_ACCESSIBLE : Paging::NONE);
+    const auto mappedPages = getCurrentAddressSpace().mapUnmappedPages(reinterpret_cast<void*>(windowAddress), pageCount, flags, true);
+
+    // If the page directory is locked, nothing has been mapped and the access will fault again
+    if (mappedPages >= 0) {
+        getCurrentAddressSpace().countPageFault(mappedPages);
+    }
+}
+
+void MemoryService::handleFileMappingFault(const FileMappingRegion &region, uint32_t pageAddress) {
+    auto &mapping = *region.mapping;
+    const auto pageIndex = (pageAddress - region.startAddress) / Util::PAGESIZE;
+
+    auto *physicalAddress = mapping.getPageFrame(pageIndex);
+    if (physicalAddress == nullptr) {
+        // The page has not been loaded yet -> Read it into a new frame through a temporary kernel mapping
+        bool zeroed;
+        auto *frame = allocatePageFrame(zeroed);
+        auto *window = mapPageFrameToKernel(frame);
+
+        // Bytes behind the end of the file must read as zero
+        if (!zeroed) {
+            Util::Address(window).setRange(0, Util::PAGESIZE);
+        }
+
+        mapping.readPage(pageIndex, window);
+        unmapPageFrameFromKernel(window);
+
+        // Another address space may have loaded the same page in the meantime
+        physicalAddress = mapping.setPageFrame(pageIndex, frame);
+        if (physicalAddress != frame) {
+            freePhysicalMemory(frame, 1);
+        }
+    }
+
+    // The address space holds its own reference to the frame, which is dropped when the page is unmapped
+    physicalAddress = pageFrameAllocator.allocateBlockAtAddress(physicalAddress);
+    const auto flags = Paging::PRESENT | Paging::USER_ACCESSIBLE | (mapping.isReadOnly() ? Paging::NONE : Paging::WRITABLE);
+    if (getCurrentAddressSpace().mapIfUnmapped(physicalAddress, reinterpret_cast<void*>(pageAddress), flags)) {
+        getCurrentAddressSpace().countPageFault(1);
+    } else {
+        // Another thread of this process has already resolved the fault
+        freePhysicalMemory(physicalAddress, 1);
+    }
+}
+
+void MemoryService::handleCopyOnWriteFault(uint32_t pageAddress) {
+    auto &addressSpace = getCurrentAddressSpace();
+    void *sharedFrame = nullptr;
+    if (addressSpace.takeOverCopyOnWritePage(reinterpret_cast<void*>(pageAddress), sharedFrame)) {
+        // Other threads of this process would fault on their stale read-only entries, which no longer belong to a copy-on-write page
+        invalidateTlbEntries(addressSpace, reinterpret_cast<void*>(pageAddress), 1);
+        return;
+    }
+
+    // The frame is still shared with another address space -> Copy it through a temporary kernel mapping
+    bool zeroed;
+    auto *frame = allocatePageFrame(zeroed);
+    auto *window = mapPageFrameToKernel(frame);
+    Util::Address(window).copyRange(Util::Address(pageAddress), Util::PAGESIZE);
+    unmapPageFrameFromKernel(window);
+
+    // Drop the reference to the shared frame, or discard the copy, if another thread has been faster
+    if (addressSpace.replaceCopyOnWritePage(reinterpret_cast<void*>(pageAddress), sharedFrame, frame)) {
+        // Other threads of this process must not keep reading the shared frame
+        invalidateTlbEntries(addressSpace, reinterpret_cast<void*>(pageAddress), 1);
+        addressSpace.countPageFault(1);
+        freePhysicalMemory(sharedFrame, 1);
+    } else {
+        freePhysicalMemory(frame, 1);
+    }
+}
+
+uint8_t* MemoryService::mapPageFrameToKernel(void *physicalAddress) {
+    // The heap page might already be mapped to an arbitrary frame, since the free list stores its headers there
+    auto *virtualAddress = static_cast<uint8_t*>(allocateKernelMemory(Util::PAGESIZE, Util::PAGESIZE));
+    unmap(virtualAddress, 1);
+    kernelAddressSpace.map(physicalAddress, virtualAddress, Paging::PRESENT | Paging::WRITABLE);
+
+    return virtualAddress;
+}
+
+void MemoryService::unmapPageFrameFromKernel(uint8_t *virtualAddress) {
+    // The calling thread may have been migrated while using the window, so other CPUs may still have it in their TLBs
+    kernelAddressSpace.unmap(virtualAddress);
+    invalidateTlbEntries(kernelAddressSpace, virtualAddress, 1);
+    freeKernelMemory(virtualAddress, Util::PAGESIZE);
+}
+
+uint16_t MemoryService::getPageFrameUseCount(void *physicalAddress) {
+    return pageFrameAllocator.getUseCount(physicalAddress);
+}
+
+void MemoryService::referencePageFrame(void *physicalAddress) {
+    pageFrameAllocator.allocateBlockAtAddress(physicalAddress);
+}
+
+VirtualAddressSpace& MemoryService::cloneCurrentAddressSpace() {
+    auto &addressSpace = createAddressSpace();
+    getCurrentAddressSpace().cloneUserSpace(addressSpace);
+
+    return addressSpace;
+}
+
+void* MemoryService::allocatePageFrame(bool &zeroed) {
+    auto *physicalAddress = zeroedFramePool.tryPop();
+    zeroed = physicalAddress != nullptr;
+
+    if (!zeroed) {
+        physicalAddress = pageFrameAllocator.allocateBlock();
+
+        // Fall back to the frames reserved for contiguous allocations (freePhysicalMemory() gives them back to the buddy allocator)
+        if (physicalAddress == nullptr && pageFrameBuddyAllocator != nullptr) {
+            physicalAddress = pageFrameBuddyAllocator->allocateBlock(1);
+        }
+
+        if (physicalAddress == nullptr) {
+            Util::Panic::fire(Util::Panic::OUT_OF_MEMORY, "MemoryService: No free page frames available!");
+        }
+    }
+
+    return physicalAddress;
+}
+
+void MemoryService::setFaultAroundPages(uint32_t pageCount) {
+    pageCount = pageCount == 0 ? 1 : (pageCount > MAX_FAULT_AROUND_PAGES ? MAX_FAULT_AROUND_PAGES : pageCount);
+
+    // Round down to a power of two, so that the aligned window never crosses a page table
+    faultAroundPages = 1;
+    while (faultAroundPages * 2 <= pageCount) {
+        faultAroundPages *= 2;
+    }
+}
+
+uint32_t MemoryService::getFaultAroundPages() const {
+    return faultAroundPages;
+}
+
+void MemoryService::refillZeroedFramePool() {
+    while (zeroedFramePool.getObjectCount() < zeroedFramePool.getCapacity()) {
+        auto *physicalAddress = pageFrameAllocator.allocateBlock();
+        if (physicalAddress == nullptr) {
+            return;
+        }
+
+        // Frames are cleared through the page clearing window of whichever CPU the refill thread is currently running on
+        if (!clearPageFrame(physicalAddress) || !zeroedFramePool.push(physicalAddress)) {
+            pageFrameAllocator.freeBlock(physicalAddress);
+            return;
+        }
+    }
+}
+
+void MemoryService::reservePageClearingWindows(uint8_t cpuCount) {
+    // Reserve a page of virtual memory for each CPU (might already be mapped by the heap)
+    auto *windows = static_cast<uint8_t*>(allocateKernelMemory(cpuCount * Util::PAGESIZE, Util::PAGESIZE));
+    unmap(windows, cpuCount);
+
+    // Kernel page tables are never freed, so the entries can be modified directly without taking the page directory lock
+    for (uint8_t i = 0; i < cpuCount; i++) {
+        pageClearingWindows[i] = windows + i * Util::PAGESIZE;
+        pageClearingWindowEntries[i] = &kernelAddressSpace.getPageTableEntry(pageClearingWindows[i]);
+    }
+}
+
+bool MemoryService::clearPageFrame(const void *physicalAddress) {
+    // Disable interrupts, so that the calling thread cannot migrate to another processor while using its window
+    const auto interruptFlags = Device::Cpu::saveAndDisableInterrupts();
+    const auto cpuId = getCurrentCpuId();
+    auto *window = pageClearingWindows[cpuId];
+    if (window == nullptr) {
+        Device::Cpu::restoreInterrupts(interruptFlags);
+        return false;
+    }
+
+    // Only this CPU accesses its window, so it never needs to be invalidated on other CPUs
+    pageClearingWindowEntries[cpuId]->set(reinterpret_cast<uint32_t>(physicalAddress), Paging::PRESENT | Paging::WRITABLE);
+    Util::Address(window).setRange(0, Util::PAGESIZE);
+    pageClearingWindowEntries[cpuId]->clear();
+
+    asm volatile (
+            "invlpg (%0)"
+            :
+            : "r"(window)
+            : "memory"
+            );
+
+    Device::Cpu::restoreInterrupts(interruptFlags);
+    return true;
 }
 
 MemoryService::MemoryStatus MemoryService::getMemoryStatus() {
-    return {pageFrameAllocator.getTotalMemory(), pageFrameAllocator.getFreeMemory(),
+    // Memory managed by the buddy allocator is marked as used in the page frame allocator
+    // Frames in the zeroed frame pool are not handed out yet, so they count as free memory as well
+    auto freeContiguousMemory = pageFrameBuddyAllocator == nullptr ? 0 : pageFrameBuddyAllocator->getFreeMemory();
+    auto zeroedMemory = zeroedFramePool.getObjectCount() * Util::PAGESIZE;
+    MemoryStatus status = {pageFrameAllocator.getTotalMemory(), pageFrameAllocator.getFreeMemory() + freeContiguousMemory + zeroedMemory,
             kernelAddressSpace.getMemoryManager().getTotalMemory(), kernelAddressSpace.getMemoryManager().getFreeMemory(),
-            pagingAreaManager.getTotalMemory(), pagingAreaManager.getFreeMemory()};
+            pagingAreaManager.getTotalMemory(), pagingAreaManager.getFreeMemory(),
+            pageFrameBuddyAllocator == nullptr ? 0 : pageFrameBuddyAllocator->getTotalMemory(), freeContiguousMemory, {}, zeroedMemory, 0};
+
+    for (uint8_t order = 0; order <= BuddyAllocator::MAX_ORDER && pageFrameBuddyAllocator != nullptr; order++) {
+        status.freeContiguousBlocks[order] = pageFrameBuddyAllocator->getFreeBlockCount(order);
+    }
+
+    for (const auto *addressSpace : addressSpaces) {
+        status.largePages += addressSpace->getLargePageCount();
+    }
+
+    return status;
 }
 
 VirtualAddressSpace& MemoryService::getKernelAddressSpace() const {
@@ -451,15 +937,151 @@ VirtualAddressSpace& MemoryService::getKernelAddressSpace() const {
 }
 
 VirtualAddressSpace &MemoryService::getCurrentAddressSpace() const {
-    return *currentAddressSpace;
+    // Disable interrupts, so that the calling thread cannot migrate to another processor between both reads
+    const auto interruptFlags = Device::Cpu::saveAndDisableInterrupts();
+    auto *addressSpace = currentAddressSpaces[getCurrentCpuId()];
+    Device::Cpu::restoreInterrupts(interruptFlags);
+
+    return *addressSpace;
+}
+
+uint8_t MemoryService::getCurrentCpuId() {
+    // Before the CPU service is available, only the bootstrap processor is running
+    return Service::isServiceRegistered(CpuService::SERVICE_ID) ? Service::getService<CpuService>().getVirtualCpuId() : 0;
+}
+
+void MemoryService::registerCurrentCpu() {
+    const auto interruptFlags = Device::Cpu::saveAndDisableInterrupts();
+    const auto cpuId = getCurrentCpuId();
+    localApicIds[cpuId] = Service::getService<InterruptService>().usesApic() ? Device::LocalApic::getId() : 0;
+    registeredCpus[cpuId] = true;
+
+    // Application processors are booted one at a time, but other CPUs may read the count concurrently
+    Util::Async::Atomic<uint32_t> countWrapper(registeredCpuCount);
+    uint32_t count;
+    do {
+        count = countWrapper.get();
+    } while (count <= cpuId && !countWrapper.compareAndSet(count, cpuId + 1));
+
+    // Shootdowns, that have been issued before this CPU was registered, did not reach it
+    flushTlb(true);
+
+    Device::Cpu::restoreInterrupts(interruptFlags);
+}
+
+void MemoryService::invalidateTlbEntries(const VirtualAddressSpace &addressSpace, const void *virtualAddress, uint32_t pageCount) {
+    // The modified page table entries must be visible, before checking which address spaces the other CPUs are running.
+    // A CPU, that switches to the address space afterward, reloads cr3 and only sees the new entries.
+    asm volatile ("lock orl $0, (%%esp)" : : : "memory");
+
+    const auto kernelRange = reinterpret_cast<uint32_t>(virtualAddress) < MemoryLayout::KERNEL_AREA.endAddress;
+    const auto interruptFlags = Device::Cpu::saveAndDisableInterrupts();
+    const auto cpuId = getCurrentCpuId();
+    if (!isTlbShootdownRequired(addressSpace, kernelRange, cpuId)) {
+        Device::Cpu::restoreInterrupts(interruptFlags);
+        return;
+    }
+
+    // Only one request can be in progress at a time.
+    // Interrupts are disabled, so requests of other CPUs must be handled while waiting for the lock.
+    while (!tlbShootdownLock.tryAcquire()) {
+        handleTlbShootdown();
+    }
+
+    tlbShootdownRequest = { reinterpret_cast<uint32_t>(virtualAddress), pageCount };
+    asm volatile ("" : : : "memory");
+
+    for (uint32_t i = 0; i < registeredCpuCount; i++) {
+        if (i != cpuId && registeredCpus[i] && (kernelRange || currentAddressSpaces[i] == &addressSpace)) {
+            tlbShootdownPending[i] = true;
+            Device::LocalApic::sendTlbShootdownInterProcessorInterrupt(localApicIds[i]);
+            Device::LocalApic::waitForInterProcessorInterruptDispatch();
+        }
+    }
+
+    // Wait until every CPU has acknowledged the request
+    for (uint32_t i = 0; i < registeredCpuCount; i++) {
+        while (tlbShootdownPending[i]) {
+            asm volatile ("pause" : : : "memory");
+        }
+    }
+
+    tlbShootdownLock.release();
+    Device::Cpu::restoreInterrupts(interruptFlags);
+}
+
+void MemoryService::handleTlbShootdown() {
+    const auto cpuId = getCurrentCpuId();
+    if (!tlbShootdownPending[cpuId]) {
+        return;
+    }
+
+    asm volatile ("" : : : "memory");
+
+    if (tlbShootdownRequest.pageCount > MAX_TLB_SHOOTDOWN_PAGES) {
+        flushTlb(tlbShootdownRequest.startAddress < MemoryLayout::KERNEL_AREA.endAddress);
+    } else {
+        for (uint32_t i = 0; i < tlbShootdownRequest.pageCount; i++) {
+            asm volatile (
+                    "invlpg (%0)"
+                    :
+                    : "r"(tlbShootdownRequest.startAddress + i * Util::PAGESIZE)
+                    : "memory"
+                    );
+        }
+    }
+
+    // Acknowledge the request
+    tlbShootdownPending[cpuId] = false;
+}
+
+void MemoryService::flushTlb(bool includeGlobal) {
+    const auto cr4 = Device::Cpu::readCr4();
+    if (includeGlobal && (cr4 & Device::Cpu::PAGE_GLOBAL_ENABLE) != 0) {
+        Device::Cpu::writeCr4(cr4 & ~static_cast<uint32_t>(Device::Cpu::PAGE_GLOBAL_ENABLE));
+        Device::Cpu::writeCr4(cr4);
+        return;
+    }
+
+    asm volatile (
+            "mov %%cr3, %%eax;"
+            "mov %%eax, %%cr3;"
+            : : :
+            "eax", "memory"
+            );
+}
+
+bool MemoryService::isTlbShootdownRequired(const VirtualAddressSpace &addressSpace, bool kernelRange, uint8_t cpuId) const {
+    for (uint32_t i = 0; i < registeredCpuCount; i++) {
+        if (i != cpuId && registeredCpus[i] && (kernelRange || currentAddressSpaces[i] == &addressSpace)) {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 const Util::ArrayList<VirtualAddressSpace *> &MemoryService::getAllAddressSpaces() const {
     return addressSpaces;
 }
 
-void MemoryService::enableSlabAllocator() {
-    slabAllocatorEnabled = true;
+void MemoryService::enableBuddyAllocator() {
+    // Reserve 1/16 of physical memory for contiguous allocations, but at least one block of the maximum order
+    auto blockCount = pageFrameAllocator.getTotalMemory() / 16 / BuddyAllocator::MAX_BLOCK_SIZE;
+    blockCount = blockCount == 0 ? 1 : (blockCount > MAX_BUDDY_BLOCKS ? MAX_BUDDY_BLOCKS : blockCount);
+
+    // Aligning the range to the maximum block size keeps all blocks naturally aligned in physical memory
+    for (; blockCount > 0; blockCount--) {
+        auto *startAddress = pageFrameAllocator.allocateContiguousBlocks(reinterpret_cast<void*>(Device::Isa::MAX_DMA_ADDRESS),
+                                                                         blockCount * (BuddyAllocator::MAX_BLOCK_SIZE / Util::PAGESIZE), BuddyAllocator::MAX_BLOCK_SIZE);
+        if (startAddress != nullptr) {
+            LOG_INFO("Reserved [%u MiB] of contiguous physical memory at [0x%08x] for the buddy allocator", blockCount * BuddyAllocator::MAX_BLOCK_SIZE / 1024 / 1024, startAddress);
+            pageFrameBuddyAllocator = new BuddyAllocator(static_cast<uint8_t*>(startAddress), blockCount);
+            return;
+        }
+    }
+
+    LOG_WARN("Not enough contiguous physical memory for the buddy allocator");
 }
 
 }
@@ -29,11 +29,17 @@
 #include "device/bus/isa/Isa.h"
 #include "kernel/memory/GlobalDescriptorTable.h"
 #include "kernel/memory/Paging.h"
-#include "kernel/memory/SlabAllocator.h"
+#include "kernel/memory/BuddyAllocator.h"
+#include "lib/util/base/BitmapMemoryManager.h"
+#include "lib/util/collection/Pool.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Kernel {
 class PageFrameAllocator;
 class PagingAreaManager;
+class FileMapping;
+struct FileMappingRegion;
+struct InterruptFrame;
 }  // namespace Kernel
 
 namespace Kernel {
@@ -54,6 +60,11 @@ public:
         uint32_t freeKernelHeapMemory;
         uint32_t totalPagingAreaMemory;
         uint32_t freePagingAreaMemory;
+        uint32_t totalContiguousMemory;
+        uint32_t freeContiguousMemory;
+        uint32_t freeContiguousBlocks[BuddyAllocator::MAX_ORDER + 1];
+        uint32_t zeroedMemory;
+        uint32_t largePages;
     };
 
     /**
@@ -147,15 +158,18 @@ public:
      * The allocated memory is 4KB-aligned, therefore the returned virtual memory address is also 4KB-aligned.
      * If the given physical address is not 4KB-aligned, one has to add a offset to the returned virtual
      * memory address in order to obtain the corresponding virtual address.
+     * Large regions outside of physical RAM are mapped to user space with 4 MiB pages, if page size extensions are enabled.
      *
      * @param physicalAddress Physical address to be mapped. This address is usually given by a hardware device (e.g. for the LFB).
      *                 If the physical address lies in the address range of the installed physical memory of the system,
      *                 please make sure you allocated that memory before!
      * @param pageCount Amount of memory to be allocated
+     * @param writeCombining Map the memory as write-combining instead of uncached (e.g. for frame buffers).
+     *                 Falls back to uncached memory, if the CPU has no page attribute table.
      *
      * @return Pointer to virtual memory block
      */
-    void* mapIO(void *physicalAddress, uint32_t pageCount, bool mapToKernelHeap = true);
+    void* mapIO(void *physicalAddress, uint32_t pageCount, bool mapToKernelHeap = true, bool writeCombining = false);
 
     /**
      * Allocate a contiguous block of physical memory and map it into the current address space's  heap.
@@ -169,6 +183,36 @@ public:
 
     bool mapSharedMemory(uint32_t sourceProcessId, const Util::String &name, void *virtualAddress);
 
+    /**
+     * Map a range of a regular file into the current address space's heap.
+     * This is not possible in the kernel address space, since file mappings are resolved by page faults in a user space heap.
+     * No data is read here. Instead, each page is read from the file, when it is accessed for the first time.
+     * Read-only mappings of the same file range share their page frames across address spaces.
+     * Writes to a writable mapping are private to the current address space and are not written back to the file.
+     *
+     * @param path Path to the file
+     * @param offset Offset into the file (must be 4KB-aligned)
+     * @param length Number of bytes to map (0 maps the whole file, starting at the given offset)
+     * @param readOnly Whether the pages should be mapped read-only
+     *
+     * @return Pointer to the start of the mapped range, or nullptr if the file cannot be mapped
+     */
+    void* mapFile(const Util::String &path, uint64_t offset, uint32_t length, bool readOnly);
+
+    /**
+     * Unmap a file mapping, that has been created by mapFile(), from the current address space.
+     *
+     * @param virtualAddress The address returned by mapFile()
+     *
+     * @return false, if no file mapping starts at the given address
+     */
+    bool unmapFile(void *virtualAddress);
+
+    /**
+     * Release a reference to a file mapping and delete it, if it is no longer used by any address space.
+     */
+    void releaseFileMapping(FileMapping &mapping);
+
     /**
      * Get the physical address of a given virtual address. The returned physical address is 4 KiB aligned, so sometimes
      * an offset may be calculated in order to get the exact physical address corresponding to the virtual address.
@@ -196,7 +240,7 @@ public:
     /**
      * Overriding function from InterruptHandler.
      */
-    void handlePageFault(uint32_t errorCode);
+    void handlePageFault(const InterruptFrame &frame, uint32_t errorCode);
 
     /**
      * Switch to a given address space.
@@ -209,25 +253,183 @@ public:
 
     VirtualAddressSpace& getCurrentAddressSpace() const;
 
+    /**
+     * Let the calling CPU take part in TLB shootdowns and flush its TLB, which may hold entries of pages,
+     * that have been unmapped before. Must be called on each CPU after its local APIC has been initialized
+     * and before it starts scheduling threads.
+     */
+    void registerCurrentCpu();
+
+    /**
+     * Invalidate the TLB entries of a range of pages on all other CPUs, that may have cached them.
+     * The kernel area is shared by all address spaces and invalidated on every CPU,
+     * user pages only on CPUs that are currently running the given address space.
+     * The calling CPU must have invalidated its own entries already and the unmapped page frames
+     * must only be freed after this function has returned.
+     * This waits for the other CPUs to acknowledge the request, so it must not be called
+     * while holding a lock, that another CPU might wait for with interrupts disabled (e.g. a page directory lock).
+     */
+    void invalidateTlbEntries(const VirtualAddressSpace &addressSpace, const void *virtualAddress, uint32_t pageCount);
+
+    /**
+     * Invalidate the TLB entries, that another CPU has requested from the calling CPU via invalidateTlbEntries().
+     * Called by the TLB shootdown IPI handler and does nothing, if no request is pending.
+     */
+    void handleTlbShootdown();
+
     const Util::ArrayList<VirtualAddressSpace*>& getAllAddressSpaces() const;
 
     MemoryStatus getMemoryStatus();
 
-    void enableSlabAllocator();
+    /**
+     * Reserve a range of physical memory for the buddy allocator, which serves contiguous allocations via allocatePhysicalMemory().
+     * Must be called during boot, while no other thread allocates page frames.
+     */
+    void enableBuddyAllocator();
+
+    /**
+     * Fill the pool of pre-zeroed page frames, which is used to serve page faults.
+     * Frames are zeroed through the page clearing window of the calling CPU (see clearPageFrame()),
+     * so the calling thread does not need to be pinned.
+     */
+    void refillZeroedFramePool();
+
+    /**
+     * Allocate a single page frame, preferably from the pool of zeroed frames.
+     * If the page frame allocator is exhausted, a frame is taken from the buddy allocator instead.
+     *
+     * @param zeroed Set to true, if the frame has already been zeroed
+     * @return Physical address of the frame
+     */
+    void* allocatePageFrame(bool &zeroed);
+
+    /**
+     * Reserve a window of virtual memory for each CPU, through which page frames can be cleared
+     * before they are mapped into an address space (see clearPageFrame()).
+     * Must be called once by the bootstrap processor, before user space threads are started.
+     */
+    void reservePageClearingWindows(uint8_t cpuCount);
+
+    /**
+     * Zero a page frame through the calling CPU's page clearing window.
+     *
+     * @return false, if no window has been reserved for the calling CPU yet
+     */
+    bool clearPageFrame(const void *physicalAddress);
+
+    /**
+     * Get the number of address spaces (and other users like file mappings), that reference a page frame.
+     *
+     * @return The use count, or 0 if the frame is not managed by the page frame allocator (e.g. memory mapped I/O)
+     */
+    uint16_t getPageFrameUseCount(void *physicalAddress);
+
+    /**
+     * Add a reference to an allocated page frame. The frame is only freed,
+     * after freePhysicalMemory() has been called once more for it.
+     */
+    void referencePageFrame(void *physicalAddress);
+
+    /**
+     * Create a new address space, that shares all user space pages of the current address space copy-on-write.
+     *
+     * @return The new address space
+     */
+    VirtualAddressSpace& cloneCurrentAddressSpace();
+
+    /**
+     * Set the number of pages, that are mapped at once, when a page fault occurs in a user space heap.
+     * The window is aligned to its size, so the value is rounded down to a power of two in [1, MAX_FAULT_AROUND_PAGES].
+     */
+    void setFaultAroundPages(uint32_t pageCount);
+
+    uint32_t getFaultAroundPages() const;
 
     static const constexpr uint8_t SERVICE_ID = 2;
+    static const constexpr uint32_t MAX_FAULT_AROUND_PAGES = 256;
 
 private:
 
-    bool slabAllocatorEnabled = false;
+    /**
+     * Resolve a page fault inside a file mapping by mapping the page frame holding the requested page
+     * and reading the page from the file first, if no address space has accessed it yet.
+     * Must be called with interrupts enabled, since reading the file may block.
+     */
+    void handleFileMappingFault(const FileMappingRegion &region, uint32_t pageAddress);
+
+    /**
+     * Resolve a write access to a copy-on-write page by taking over the page frame,
+     * if it is not shared anymore, or by copying it into a new frame.
+     * Must be called with interrupts enabled.
+     */
+    void handleCopyOnWriteFault(uint32_t pageAddress);
+
+    /**
+     * Map a page frame into a page of the kernel heap, so that it can be accessed independently of the current user space.
+     */
+    uint8_t* mapPageFrameToKernel(void *physicalAddress);
+
+    void unmapPageFrameFromKernel(uint8_t *virtualAddress);
+
+    /**
+     * Check if page size extensions are enabled and a range of device memory can be mapped using 4 MiB pages.
+     */
+    bool isLargePageMappingPossible(void *physicalAddress, uint32_t pageCount) const;
+
+    /**
+     * Get the virtual id of the calling processor, which is used to index the per-processor address space table.
+     */
+    static uint8_t getCurrentCpuId();
+
+    /**
+     * Invalidate a range of unmapped pages on all other CPUs and free the page frames, that were mapped there afterward.
+     */
+    void freeUnmappedFrames(const VirtualAddressSpace &addressSpace, uint32_t startAddress, uint32_t endAddress, void **frames, uint32_t frameCount);
+
+    /**
+     * Check if any other CPU needs to invalidate its TLB entries for a range of the given address space.
+     */
+    bool isTlbShootdownRequired(const VirtualAddressSpace &addressSpace, bool kernelRange, uint8_t cpuId) const;
+
+    /**
+     * Flush the whole TLB of the calling CPU. Reloading cr3 keeps global kernel entries,
+     * so they are only flushed if 'includeGlobal' is set (by toggling page global enable).
+     */
+    static void flushTlb(bool includeGlobal);
+
+    struct TlbShootdownRequest {
+        uint32_t startAddress;
+        uint32_t pageCount;
+    };
+
     PageFrameAllocator &pageFrameAllocator;
     PagingAreaManager &pagingAreaManager;
-    SlabAllocator pageFrameSlabAllocator;
+    BuddyAllocator *pageFrameBuddyAllocator = nullptr;
     Util::BitmapMemoryManager kernelStackAllocator;
 
     Util::ArrayList<VirtualAddressSpace*> addressSpaces;
-    VirtualAddressSpace *currentAddressSpace;
+    VirtualAddressSpace *currentAddressSpaces[256]{};
     VirtualAddressSpace &kernelAddressSpace;
+
+    TlbShootdownRequest tlbShootdownRequest{};
+    Util::Async::Spinlock tlbShootdownLock;
+    volatile bool tlbShootdownPending[256]{};
+    bool registeredCpus[256]{};
+    uint8_t localApicIds[256]{};
+    uint32_t registeredCpuCount = 0; // Highest registered virtual CPU id + 1
+
+    Util::Pool<void> zeroedFramePool;
+    uint8_t *pageClearingWindows[256]{};
+    Paging::Entry *pageClearingWindowEntries[256]{};
+    uint32_t faultAroundPages = DEFAULT_FAULT_AROUND_PAGES;
+
+    Util::ArrayList<FileMapping*> sharedFileMappings;
+    Util::Async::Spinlock fileMappingLock;
+
+    static const constexpr uint32_t MAX_BUDDY_BLOCKS = 8;
+    static const constexpr uint32_t ZEROED_FRAME_POOL_SIZE = 256;
+    static const constexpr uint32_t DEFAULT_FAULT_AROUND_PAGES = 16;
+    static const constexpr uint32_t MAX_TLB_SHOOTDOWN_PAGES = 32; // Larger ranges are invalidated by flushing the whole TLB
 };
 
 }
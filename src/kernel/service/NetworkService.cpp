@@ -38,6 +38,7 @@
 #include "lib/util/base/System.h"
 #include "FilesystemService.h"
 #include "MemoryService.h"
+#include "kernel/memory/VirtualAddressSpace.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/network/Datagram.h"
 #include "kernel/network/Socket.h"
@@ -80,16 +81,11 @@ NetworkService::NetworkService() {
             return false;
         }
 
-        auto &filesystemService = Service::getService<FilesystemService>();
+        auto &networkService = Service::getService<NetworkService>();
         auto fileDescriptor = va_arg(arguments, int32_t);
         auto &datagram = *va_arg(arguments, Util::Network::Datagram*);
 
-        auto &socket = reinterpret_cast<Network::Socket&>(filesystemService.getFileDescriptor(fileDescriptor).getNode());
-        if (!socket.isBound()) {
-            Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Socket: Not yet bound!");
-        }
-
-        return socket.send(datagram);
+        return networkService.sendDatagram(fileDescriptor, datagram);
     });
 
     Service::getService<InterruptService>().assignSystemCall(Util::System::RECEIVE_DATAGRAM, [](uint32_t paramCount, va_list arguments) -> bool {
@@ -97,42 +93,63 @@ NetworkService::NetworkService() {
             return false;
         }
 
-        auto &filesystemService = Service::getService<FilesystemService>();
-        auto &memoryService = Service::getService<MemoryService>();
+        auto &networkService = Service::getService<NetworkService>();
         auto fileDescriptor = va_arg(arguments, int32_t);
         auto &datagram = *va_arg(arguments, Util::Network::Datagram*);
 
-        auto &socketDescriptor = filesystemService.getFileDescriptor(fileDescriptor);
-        auto &socket = reinterpret_cast<Network::Socket&>(socketDescriptor.getNode());
-        if (!socket.isBound()) {
-            Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Socket: Not yet bound!");
+        // The kernel cannot write to read-only user pages either, so the datagram must be checked beforehand
+        if (!Service::getService<MemoryService>().getCurrentAddressSpace().isWritableUserRange(&datagram, sizeof(Util::Network::Datagram))) {
+            return false;
         }
 
-        if (socketDescriptor.getAccessMode() == Util::Io::File::BLOCKING || socket.isReadyToRead()) {
-            // Receive the datagram from the socket (will block if no datagram is available)
-            // If the descriptor is non-blocking, we have already checked if the socket is ready to read
-            auto *kernelDatagram = socket.receive();
-            if (kernelDatagram == nullptr) {
-                return false;
-            }
+        return networkService.receiveDatagram(fileDescriptor, datagram);
+    });
+}
+
+bool NetworkService::sendDatagram(int32_t fileDescriptor, const Util::Network::Datagram &datagram) {
+    auto &filesystemService = Service::getService<FilesystemService>();
+    auto &socket = reinterpret_cast<Network::Socket&>(filesystemService.getFileDescriptor(fileDescriptor).getNode());
+    if (!socket.isBound()) {
+        Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Socket: Not yet bound!");
+    }
 
-            auto *datagramBuffer = reinterpret_cast<uint8_t *>(memoryService.allocateUserMemory(kernelDatagram->getLength()));
+    return socket.send(datagram);
+}
 
-            auto source = Util::Address(kernelDatagram->getData());
-            auto target = Util::Address(datagramBuffer);
-            target.copyRange(source, kernelDatagram->getLength());
+bool NetworkService::receiveDatagram(int32_t fileDescriptor, Util::Network::Datagram &datagram) {
+    auto &filesystemService = Service::getService<FilesystemService>();
+    auto &memoryService = Service::getService<MemoryService>();
 
-            datagram.setData(datagramBuffer, kernelDatagram->getLength());
-            datagram.setRemoteAddress(kernelDatagram->getRemoteAddress());
-            datagram.setAttributes(*kernelDatagram);
+    auto &socketDescriptor = filesystemService.getFileDescriptor(fileDescriptor);
+    auto &socket = reinterpret_cast<Network::Socket&>(socketDescriptor.getNode());
+    if (!socket.isBound()) {
+        Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "Socket: Not yet bound!");
+    }
 
-            delete kernelDatagram;
-            return true;
-        } else {
-            // The descriptor is non-blocking and the socket is not ready to read
+    if (socketDescriptor.getAccessMode() == Util::Io::File::BLOCKING || socket.isReadyToRead()) {
+        // Receive the datagram from the socket (will block if no datagram is available)
+        // If the descriptor is non-blocking, we have already checked if the socket is ready to read
+        auto *kernelDatagram = socket.receive();
+        if (kernelDatagram == nullptr) {
             return false;
         }
-    });
+
+        auto *datagramBuffer = reinterpret_cast<uint8_t *>(memoryService.allocateUserMemory(kernelDatagram->getLength()));
+
+        auto source = Util::Address(kernelDatagram->getData());
+        auto target = Util::Address(datagramBuffer);
+        target.copyRange(source, kernelDatagram->getLength());
+
+        datagram.setData(datagramBuffer, kernelDatagram->getLength());
+        datagram.setRemoteAddress(kernelDatagram->getRemoteAddress());
+        datagram.setAttributes(*kernelDatagram);
+
+        delete kernelDatagram;
+        return true;
+    } else {
+        // The descriptor is non-blocking and the socket is not ready to read
+        return false;
+    }
 }
 
 void NetworkService::initializeLoopback() {
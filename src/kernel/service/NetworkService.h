@@ -84,6 +84,10 @@ public:
 
     int32_t createSocket(Util::Network::Socket::Type socketType);
 
+    bool sendDatagram(int32_t fileDescriptor, const Util::Network::Datagram &datagram);
+
+    bool receiveDatagram(int32_t fileDescriptor, Util::Network::Datagram &datagram);
+
     static const constexpr uint8_t SERVICE_ID = 8;
 
 private:
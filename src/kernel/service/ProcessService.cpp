@@ -22,6 +22,7 @@
 
 #include "kernel/process/AddressSpaceCleaner.h"
 #include "kernel/process/BinaryLoader.h"
+#include "kernel/process/CloneLoader.h"
 #include "ProcessService.h"
 #include "FilesystemService.h"
 #include "kernel/process/FileDescriptorManager.h"
@@ -78,10 +79,12 @@ ProcessService::ProcessService(Process *kernelProcess) : kernelProcess(kernelPro
         auto *runnable = va_arg(arguments, Util::Async::Runnable*);
         auto eip = va_arg(arguments, uint32_t);
         auto &threadId = *va_arg(arguments, uint32_t*);
+        auto affinity = paramCount > 4 ? va_arg(arguments, uint32_t) : Scheduler::ALL_CPUS;
 
         auto &thread = Kernel::Thread::createUserThread(name, processService.getCurrentProcess(), eip, runnable);
 
         threadId = thread.getId();
+        processService.getScheduler().setAffinity(thread, affinity);
         processService.getScheduler().ready(thread);
         return true;
     });
@@ -98,6 +101,75 @@ ProcessService::ProcessService(Process *kernelProcess) : kernelProcess(kernelPro
         return true;
     });
 
+    Service::getService<InterruptService>().assignSystemCall(Util::System::SET_THREAD_NICE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto threadId = va_arg(arguments, uint32_t);
+        auto nice = va_arg(arguments, int32_t);
+
+        auto *thread = processService.getScheduler().getThread(threadId);
+        if (thread == nullptr) {
+            return false;
+        }
+
+        processService.getScheduler().setNice(*thread, static_cast<int8_t>(nice));
+        return true;
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::SET_THREAD_AFFINITY, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto threadId = va_arg(arguments, uint32_t);
+        auto affinity = va_arg(arguments, uint32_t);
+
+        auto *thread = processService.getScheduler().getThread(threadId);
+        if (thread == nullptr) {
+            return false;
+        }
+
+        return processService.getScheduler().setAffinity(*thread, affinity);
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::WAIT_ON_ADDRESS, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto *address = va_arg(arguments, const volatile uint32_t*);
+        auto expectedValue = va_arg(arguments, uint32_t);
+
+        if (address == nullptr || reinterpret_cast<uint32_t>(address) % sizeof(uint32_t) != 0) {
+            return false;
+        }
+
+        return processService.getScheduler().waitOnAddress(address, expectedValue);
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::WAKE_ADDRESS, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 3) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto *address = va_arg(arguments, const volatile uint32_t*);
+        auto count = va_arg(arguments, uint32_t);
+        auto *wokenThreads = va_arg(arguments, uint32_t*);
+
+        if (address == nullptr || reinterpret_cast<uint32_t>(address) % sizeof(uint32_t) != 0) {
+            return false;
+        }
+
+        *wokenThreads = processService.getScheduler().wakeAddress(address, count);
+        return true;
+    });
+
     Service::getService<InterruptService>().assignSystemCall(Util::System::JOIN_THREAD, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 1) {
             return false;
@@ -146,6 +218,25 @@ ProcessService::ProcessService(Process *kernelProcess) : kernelProcess(kernelPro
         return true;
     });
 
+    Service::getService<InterruptService>().assignSystemCall(Util::System::CLONE_PROCESS, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 6) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto *runnable = va_arg(arguments, Util::Async::Runnable*);
+        auto eip = va_arg(arguments, uint32_t);
+        auto *inputFile = va_arg(arguments, Util::Io::File*);
+        auto *outputFile = va_arg(arguments, Util::Io::File*);
+        auto *errorFile = va_arg(arguments, Util::Io::File*);
+        auto &processId = *va_arg(arguments, uint32_t*);
+
+        auto &process = processService.cloneCurrentProcess(eip, runnable, *inputFile, *outputFile, *errorFile);
+
+        processId = process.getId();
+        return true;
+    });
+
     Service::getService<InterruptService>().assignSystemCall(Util::System::GET_CURRENT_PROCESS, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 1) {
             return false;
@@ -218,6 +309,52 @@ ProcessService::ProcessService(Process *kernelProcess) : kernelProcess(kernelPro
 
         return currentProcess.createSharedMemory(name, startAddress, pageCount);
     });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::CREATE_IO_RING, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto &currentProcess = processService.getCurrentProcess();
+
+        auto &header = *va_arg(arguments, Util::Async::IoRing::Header*);
+        auto workerCount = va_arg(arguments, uint32_t);
+
+        return currentProcess.createIoRing(header, workerCount);
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::SUBMIT_IO_RING, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto &currentProcess = processService.getCurrentProcess();
+
+        auto &header = *va_arg(arguments, Util::Async::IoRing::Header*);
+        auto &pending = *va_arg(arguments, uint32_t*);
+
+        auto *ring = currentProcess.getIoRing(header);
+        if (ring == nullptr) {
+            return false;
+        }
+
+        pending = ring->submit();
+        return true;
+    });
+
+    Service::getService<InterruptService>().assignSystemCall(Util::System::DESTROY_IO_RING, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 1) {
+            return false;
+        }
+
+        auto &processService = Service::getService<ProcessService>();
+        auto &currentProcess = processService.getCurrentProcess();
+
+        auto &header = *va_arg(arguments, Util::Async::IoRing::Header*);
+        return currentProcess.destroyIoRing(header);
+    });
 }
 
 Process& ProcessService::createProcess(VirtualAddressSpace &addressSpace, const Util::String &name, const Util::Io::File &workingDirectory, const Util::Io::File &standardIn, const Util::Io::File &standardOut, const Util::Io::File &standardError) {
@@ -248,11 +385,27 @@ Process& ProcessService::loadBinary(const Util::Io::File &binaryFile, const Util
     return process;
 }
 
+Process& ProcessService::cloneCurrentProcess(uint32_t eip, Util::Async::Runnable *runnable, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile) {
+    auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
+    auto &parent = getCurrentProcess();
+    if (parent.isKernelProcess()) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "ProcessService: The kernel process cannot be cloned!");
+    }
+
+    auto &virtualAddressSpace = memoryService.cloneCurrentAddressSpace();
+    auto &process = createProcess(virtualAddressSpace, parent.getName(), parent.getWorkingDirectory(), inputFile, outputFile, errorFile);
+    auto &thread = Kernel::Thread::createKernelThread("Loader", process, new Kernel::CloneLoader(parent.getName(), eip, runnable));
+
+    scheduler.ready(thread);
+    return process;
+}
+
 void ProcessService::killProcess(Process &process) {
     if (process == getCurrentProcess()) {
         Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "A process cannot kill itself!");
     }
 
+    process.stopIoRings();
     for (auto *thread : process.getThreads()) {
         scheduler.kill(*thread);
     }
@@ -288,6 +441,7 @@ void ProcessService::exitCurrentProcess(int32_t exitCode) {
     auto &process = getCurrentProcess();
     auto &cleanerThread = Thread::createKernelThread("Address-Space-Cleaner", process, new AddressSpaceCleaner());
 
+    process.stopIoRings();
     process.killAllThreadsButCurrent();
     scheduler.ready(cleanerThread);
 
@@ -34,6 +34,9 @@ namespace Util {
 namespace Io {
 class File;
 }  // namespace File
+namespace Async {
+class Runnable;
+}  // namespace Async
 }  // namespace Util
 
 namespace Kernel {
@@ -69,6 +72,16 @@ public:
 
     Process& loadBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments);
 
+    /**
+     * Create a new process, that shares the memory of the current process copy-on-write,
+     * and run a runnable from the current process' memory in its main thread.
+     * Only memory is cloned. The new process starts with a single thread and opens the given standard files.
+     *
+     * @param eip The user space function, that runs the runnable and exits the new process
+     * @param runnable The runnable to execute (must be allocated in user space memory)
+     */
+    Process& cloneCurrentProcess(uint32_t eip, Util::Async::Runnable *runnable, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile);
+
     void killProcess(Process &process);
 
     [[noreturn]] void exitCurrentProcess(int32_t exitCode);
@@ -28,10 +28,23 @@
 #include "InterruptService.h"
 #include "kernel/service/Service.h"
 #include "device/time/WaitTimer.h"
+#include "device/cpu/Cpu.h"
+#include "kernel/memory/Paging.h"
+#include "kernel/memory/VirtualAddressSpace.h"
+#include "kernel/service/MemoryService.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/base/Constants.h"
+#include "lib/util/time/TimePage.h"
 
 namespace Kernel {
 
 TimeService::TimeService(Device::WaitTimer *waitTimer) : waitTimer(waitTimer) {
+    // The time page is written via the kernel heap and mapped read-only into every user space
+    auto &memoryService = Service::getService<MemoryService>();
+    timePage = static_cast<Util::Time::TimePage*>(memoryService.allocateKernelMemory(Util::PAGESIZE, Util::PAGESIZE));
+    Util::Address(timePage).setRange(0, Util::PAGESIZE);
+    timePagePhysicalAddress = memoryService.getPhysicalAddress(timePage);
+
     Service::getService<InterruptService>().assignSystemCall(Util::System::GET_SYSTEM_TIME, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 1) {
             return false;
@@ -77,6 +90,10 @@ void TimeService::setTimeProvider(Device::TimeProvider *timeProvider) {
 void TimeService::setDateProvider(Device::DateProvider *dateProvider) {
     delete TimeService::dateProvider;
     TimeService::dateProvider = dateProvider;
+
+    if (dateProvider != nullptr) {
+        publishCurrentDate(dateProvider->getCurrentDate());
+    }
 }
 
 Util::Time::Timestamp TimeService::getSystemTime() const {
@@ -97,7 +114,8 @@ Util::Time::Date TimeService::getCurrentDate() const {
 
 void TimeService::setCurrentDate(const Util::Time::Date &date) {
     if (dateProvider != nullptr) {
-        return dateProvider->setCurrentDate(date);
+        dateProvider->setCurrentDate(date);
+        publishCurrentDate(date);
     } else {
         Util::Panic::fire(Util::Panic::ILLEGAL_STATE, "TimeService: No date provider available!");
     }
@@ -107,4 +125,74 @@ void TimeService::busyWait(const Util::Time::Timestamp &time) const {
     waitTimer->wait(time);
 }
 
-}
\ No newline at end of file
+void TimeService::publishSystemTime(const Util::Time::Timestamp &systemTime, uint64_t counterValue) {
+    auto interruptFlags = beginTimePageUpdate();
+
+    timePage->systemTime = systemTime.toNanoseconds();
+    timePage->counterValue = counterValue;
+    timePage->tickCount++;
+    timePage->flags |= Util::Time::TimePage::SYSTEM_TIME_VALID;
+
+    endTimePageUpdate(interruptFlags);
+}
+
+void TimeService::publishCurrentDate(const Util::Time::Date &date) {
+    auto interruptFlags = beginTimePageUpdate();
+
+    timePage->unixTime = date.getUnixTime();
+    timePage->flags |= Util::Time::TimePage::DATE_VALID;
+
+    endTimePageUpdate(interruptFlags);
+}
+
+void TimeService::setTimePageCounter(void *physicalAddress, uint64_t femtosecondsPerTick, uint64_t maxValue) {
+    const auto pageOffset = reinterpret_cast<uint32_t>(physicalAddress) % Util::PAGESIZE;
+    if (pageOffset > Util::PAGESIZE - sizeof(uint64_t)) {
+        Util::Panic::fire(Util::Panic::INVALID_ARGUMENT, "TimeService: Counter crosses page boundary!");
+    }
+
+    counterPagePhysicalAddress = reinterpret_cast<void*>(reinterpret_cast<uint32_t>(physicalAddress) - pageOffset);
+
+    auto interruptFlags = beginTimePageUpdate();
+
+    timePage->counterAddress = Util::TIME_COUNTER_PAGE_ADDRESS + pageOffset;
+    timePage->counterMaxValue = maxValue;
+    timePage->femtosecondsPerTick = femtosecondsPerTick;
+
+    endTimePageUpdate(interruptFlags);
+}
+
+void TimeService::mapTimePage(VirtualAddressSpace &addressSpace) const {
+    auto &memoryService = Service::getService<MemoryService>();
+
+    // Each mapping holds a reference, which is released when the address space is cleaned up
+    memoryService.referencePageFrame(timePagePhysicalAddress);
+    addressSpace.map(timePagePhysicalAddress, reinterpret_cast<void*>(Util::TIME_PAGE_ADDRESS), Paging::PRESENT | Paging::USER_ACCESSIBLE);
+
+    if (counterPagePhysicalAddress != nullptr) {
+        memoryService.referencePageFrame(counterPagePhysicalAddress);
+        addressSpace.map(counterPagePhysicalAddress, reinterpret_cast<void*>(Util::TIME_COUNTER_PAGE_ADDRESS), Paging::PRESENT | Paging::USER_ACCESSIBLE | Paging::CACHE_DISABLE);
+    }
+}
+
+uint32_t TimeService::beginTimePageUpdate() {
+    // The time page is updated by interrupt handlers -> Keep interrupts disabled and spin instead of yielding
+    auto interruptFlags = Device::Cpu::saveAndDisableInterrupts();
+    while (!timePageLock.tryAcquire()) {}
+
+    // An odd sequence tells readers that an update is in progress (x86 does not reorder stores, so a compiler barrier suffices)
+    timePage->sequence = timePage->sequence + 1;
+    asm volatile ("" : : : "memory");
+
+    return interruptFlags;
+}
+
+void TimeService::endTimePageUpdate(uint32_t interruptFlags) {
+    asm volatile ("" : : : "memory");
+    timePage->sequence = timePage->sequence + 1;
+
+    timePageLock.release();
+    Device::Cpu::restoreInterrupts(interruptFlags);
+}
+
+}
@@ -24,6 +24,7 @@
 #include <stdint.h>
 
 #include "Service.h"
+#include "lib/util/async/Spinlock.h"
 #include "lib/util/time/Date.h"
 #include "lib/util/time/Timestamp.h"
 
@@ -33,7 +34,14 @@ class DateProvider;
 class TimeProvider;
 }  // namespace Device
 
+namespace Util {
+namespace Time {
+struct TimePage;
+}  // namespace Time
+}  // namespace Util
+
 namespace Kernel {
+class VirtualAddressSpace;
 
 class TimeService : public Service {
 
@@ -70,13 +78,52 @@ public:
 
     void busyWait(const Util::Time::Timestamp &time) const;
 
+    /**
+     * Publish the system time to the time page, which is mapped read-only into every user space.
+     * The time provider calls this from its interrupt handler, whenever it has advanced the system time.
+     * If the time provider has a counter, which is readable from user space (see setTimePageCounter()),
+     * it also passes the counter value corresponding to the given system time.
+     */
+    void publishSystemTime(const Util::Time::Timestamp &systemTime, uint64_t counterValue = 0);
+
+    /**
+     * Publish the current date to the time page.
+     * The date provider calls this, whenever its date has changed.
+     */
+    void publishCurrentDate(const Util::Time::Date &date);
+
+    /**
+     * Map the free running counter of the time provider read-only into every user space,
+     * allowing processes to interpolate the system time between two calls of publishSystemTime().
+     * This must be done before the first user space is created.
+     *
+     * @param physicalAddress The physical address of the counter register (low 32 bits, followed by the high 32 bits)
+     * @param femtosecondsPerTick The length of a counter tick
+     * @param maxValue The highest counter value, after which it wraps around
+     */
+    void setTimePageCounter(void *physicalAddress, uint64_t femtosecondsPerTick, uint64_t maxValue);
+
+    /**
+     * Map the time page (and the counter, if set) into a newly created user space.
+     */
+    void mapTimePage(VirtualAddressSpace &addressSpace) const;
+
     static const constexpr uint8_t SERVICE_ID = 6;
 
 private:
 
+    uint32_t beginTimePageUpdate();
+
+    void endTimePageUpdate(uint32_t interruptFlags);
+
     Device::WaitTimer *waitTimer;
     Device::TimeProvider *timeProvider = nullptr;
     Device::DateProvider *dateProvider = nullptr;
+
+    Util::Time::TimePage *timePage;
+    void *timePagePhysicalAddress;
+    void *counterPagePhysicalAddress = nullptr;
+    Util::Async::Spinlock timePageLock;
 };
 
 }
@@ -37,7 +37,9 @@ namespace Kernel {
 AudioMixer::AudioMixer() : idGenerator(256), streams(256),
         runnable(new AudioMixerRunnable(*this, BUFFER_SIZE)),
         thread(Thread::createKernelProcessThread("Audio-Mixer", runnable)) {
+    // The mixer needs to refill the sound card's buffer in time, even if CPU-bound threads are running
     auto &processService = Service::getService<ProcessService>();
+    processService.getScheduler().setNice(thread, -10);
     processService.getScheduler().ready(thread);
 
     auto &filesystemService = Service::getService<FilesystemService>();
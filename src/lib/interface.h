@@ -33,6 +33,7 @@
 
 #include <stddef.h>
 
+#include "util/async/IoRing.h"
 #include "util/async/Process.h"
 #include "util/async/Thread.h"
 #include "util/base/Panic.h"
@@ -64,7 +65,9 @@ bool isMemoryManagementInitialized();
 /// Map a physical memory region into the virtual address space of the calling process.
 /// The region starts at the given physical address and spans the given number of pages.
 /// The virtual memory region is allocated on the heap of the calling process and a pointer to its start is returned.
-void* mapIO(size_t physicalAddress, size_t pageCount);
+/// Device memory is uncached by default. Frame buffers should be mapped as write-combining instead,
+/// which buffers sequential writes and is much faster for copying whole images.
+void* mapIO(size_t physicalAddress, size_t pageCount, bool writeCombining = false);
 
 /// Unmap a previously mapped virtual memory region from the address space of the calling process.
 /// The region starts at the given virtual address and spans the given number of pages.
@@ -81,6 +84,30 @@ void* mapIO(size_t physicalAddress, size_t pageCount);
 /// after it has encountered the given number of unmapped pages in a row.
 void unmap(void *virtualAddress, size_t pageCount, size_t breakCount = 0);
 
+/// Map a range of a regular file into the virtual address space of the calling process.
+/// The offset must be page aligned and a length of 0 maps the whole file, starting at the offset.
+/// No data is read by this call. Instead, each page is read from the file, when it is accessed for the first time.
+/// Read-only mappings of the same file range share their memory with other processes.
+/// Writes to a writable mapping are private to the calling process and are not written back to the file.
+/// Bytes behind the end of the file read as zero.
+/// Return a pointer to the start of the mapped range, or a null pointer if the file cannot be mapped.
+///
+/// ### Example
+/// ```c++
+/// const auto length = Util::Io::File("/initrd/bin/shell").getLength();
+/// const auto *data = static_cast<const uint8_t*>(mapFile("/initrd/bin/shell", 0, length));
+///
+/// // Only the pages containing the ELF header are read from the file here
+/// const auto isElf = data[0] == 0x7f && data[1] == 'E' && data[2] == 'L' && data[3] == 'F';
+///
+/// unmapFile(const_cast<uint8_t*>(data));
+/// ```
+void* mapFile(const Util::String &path, uint64_t offset, size_t length, bool readOnly = true);
+
+/// Unmap a file mapping, that has been created by `mapFile()`, and free its virtual memory.
+/// Return false, if the given address is not the start of a file mapping.
+bool unmapFile(void *virtualAddress);
+
 /// Mount a filesystem driver at the given target path, using the specified device and driver.
 ///
 /// ### Example
@@ -130,6 +157,24 @@ uint64_t readFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t pos, u
 /// The actual number of bytes written is returned.
 uint64_t writeFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t pos, uint64_t length);
 
+/// Read data from the file associated with the given file descriptor into multiple buffers with a single system call.
+/// Each vector specifies its own target buffer, file position and length. The vectors are processed in order
+/// and the transfer stops at the first vector that could not be filled completely (e.g. at the end of the file).
+/// The total number of bytes read over all vectors is returned.
+uint64_t readFileVector(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, size_t count);
+
+/// Write data from multiple buffers to the file associated with the given file descriptor with a single system call.
+/// Each vector specifies its own source buffer, file position and length. The vectors are processed in order
+/// and the transfer stops at the first vector that could not be written completely.
+/// The total number of bytes written over all vectors is returned.
+uint64_t writeFileVector(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, size_t count);
+
+/// Copy up to the specified length in bytes from one file to another without passing the data through user space.
+/// Reading starts at the source position in the source file and writing at the target position in the target file.
+/// The copy may stop early (e.g. at the end of the source file), so the actual number of bytes copied is returned.
+uint64_t copyFileRange(int32_t sourceFileDescriptor, uint64_t sourcePos, int32_t targetFileDescriptor,
+    uint64_t targetPos, uint64_t length);
+
 /// Issue a control request to the file associated with the given file descriptor.
 /// The request is specified by the request code and the parameters.
 /// This can for example be used to manipulate devices via files they expose.
@@ -161,6 +206,19 @@ bool createPipe(const Util::String &name);
 /// Return true on success, false otherwise.
 bool createSharedMemory(const Util::String &name, void *startAddress, size_t pageCount);
 
+/// Register an I/O ring, whose memory starts with the given header, at the kernel.
+/// The kernel starts the given number of worker threads, which execute the submitted operations.
+/// Return true on success, false otherwise (e.g. if the entry count is not a power of two).
+bool createIoRing(Util::Async::IoRing::Header &header, size_t workerCount);
+
+/// Wake up the worker threads of an I/O ring, so that they start the operations in its submission queue.
+/// Return the amount of submitted operations, which have not been started yet.
+size_t submitIoRing(Util::Async::IoRing::Header &header);
+
+/// Unregister an I/O ring from the kernel, after all running operations have finished.
+/// Return true on success, false if the ring is not registered.
+bool destroyIoRing(Util::Async::IoRing::Header &header);
+
 /// Create a network socket of the specified type (e.g., UDP).
 /// Return the file descriptor of the created socket, or -1 on error.
 int32_t createSocket(Util::Network::Socket::Type socketType);
@@ -179,12 +237,20 @@ bool receiveDatagram(int32_t fileDescriptor, Util::Network::Datagram &datagram);
 /// Return a `Util::Async::Process` object representing the created process.
 Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile, const Util::String &command, const Util::Array<Util::String> &arguments);
 
+/// Create a new process, that shares the memory of the calling process copy-on-write,
+/// and run the given `Util::Async::Runnable` object in its main thread.
+/// The new process exits when the runnable returns. It uses the given input, output and error files,
+/// while all other file descriptors and threads of the calling process are not cloned.
+/// Return a `Util::Async::Process` object representing the created process.
+Util::Async::Process cloneProcess(Util::Async::Runnable *runnable, const Util::Io::File &inputFile, const Util::Io::File &outputFile, const Util::Io::File &errorFile);
+
 /// Get a `Util::Async::Process` object representing the currently running process.
 Util::Async::Process getCurrentProcess();
 
 /// Create a new thread with the given name that runs the specified `Util::Async::Runnable` object.
+/// The thread is only scheduled on the CPUs contained in the affinity mask.
 /// Return a `Util::Async::Thread` object representing the created thread.
-Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable);
+Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable, uint32_t affinity);
 
 /// Get a `Util::Async::Thread` object representing the currently running thread.
 Util::Async::Thread getCurrentThread();
@@ -202,9 +268,33 @@ void killProcess(size_t id);
 /// Put the current thread to sleep for the specified duration.
 void sleep(const Util::Time::Timestamp &time);
 
+/// Set the nice value of the thread with the given ID, biasing its scheduling priority.
+/// Return true on success, or false if the thread does not exist.
+bool setThreadNice(size_t id, int8_t nice);
+
+/// Set the affinity mask of the thread with the given ID (bit n allows the CPU with virtual ID n).
+/// Return true on success, or false if the thread does not exist or the mask contains no available CPU.
+bool setThreadAffinity(size_t id, uint32_t affinity);
+
 /// Yield the CPU to allow other threads to run.
 void yield();
 
+/// Block the calling thread, as long as the 32-bit value at the given address equals `expectedValue`,
+/// until another thread calls `wakeAddress()` on the same address.
+/// The value is compared atomically with respect to `wakeAddress()`, so that a wakeup cannot get lost
+/// between checking the value and going to sleep. Spurious wakeups are possible, so the caller must check its condition again.
+/// Return true, if the thread has been blocked, or false if the value did not match (or waiting is not possible yet).
+bool waitOnAddress(const volatile uint32_t *address, uint32_t expectedValue);
+
+/// Wake up to `count` threads, that are waiting on the given address via `waitOnAddress()`.
+/// Return the number of threads that have been woken up.
+size_t wakeAddress(const volatile uint32_t *address, size_t count);
+
+/// Check if a thread may sleep while waiting for a contended lock (see `Util::Async::Spinlock`).
+/// Kernel spinlocks also protect the scheduler, memory management and interrupt handlers, so they must keep spinning.
+/// For user space programs, this always returns true.
+bool isLockSleepingAllowed();
+
 /// Check if the scheduler has been initialized.
 /// For user space programs, this always returns true.
 bool isSchedulerInitialized();
@@ -42,6 +42,7 @@
 #include "kernel/memory/MemoryLayout.h"
 #include "kernel/network/Socket.h"
 #include "kernel/process/FileDescriptor.h"
+#include "kernel/process/IoRing.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/Scheduler.h"
 #include "kernel/process/Thread.h"
@@ -77,9 +78,9 @@ bool isMemoryManagementInitialized() {
     return Kernel::Service::isServiceRegistered(Kernel::MemoryService::SERVICE_ID);
 }
 
-void* mapIO(const size_t physicalAddress, const size_t pageCount) {
+void* mapIO(const size_t physicalAddress, const size_t pageCount, const bool writeCombining) {
     auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
-    return memoryService.mapIO(reinterpret_cast<void*>(physicalAddress), pageCount, false);
+    return memoryService.mapIO(reinterpret_cast<void*>(physicalAddress), pageCount, false, writeCombining);
 }
 
 void unmap(void *virtualAddress, const size_t pageCount, const size_t breakCount) {
@@ -87,6 +88,16 @@ void unmap(void *virtualAddress, const size_t pageCount, const size_t breakCount
     memoryService.unmap(virtualAddress, pageCount, breakCount);
 }
 
+void* mapFile(const Util::String &path, const uint64_t offset, const size_t length, const bool readOnly) {
+    auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
+    return memoryService.mapFile(path, offset, length, readOnly);
+}
+
+bool unmapFile(void *virtualAddress) {
+    auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
+    return memoryService.unmapFile(virtualAddress);
+}
+
 bool mount(const Util::String &deviceName, const Util::String &targetPath, const Util::String &driverName) {
     auto &filesystemService = Kernel::Service::getService<Kernel::FilesystemService>();
     return filesystemService.mount(deviceName, targetPath, driverName);
@@ -171,6 +182,21 @@ uint64_t writeFile(const int32_t fileDescriptor, const uint8_t *sourceBuffer, co
     return filesystemService.getFileDescriptor(fileDescriptor).getNode().writeData(sourceBuffer, pos, length);
 }
 
+uint64_t readFileVector(const int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, const size_t count) {
+    return Kernel::Service::getService<Kernel::FilesystemService>().readFileVector(fileDescriptor, vectors, count);
+}
+
+uint64_t writeFileVector(const int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, const size_t count) {
+    return Kernel::Service::getService<Kernel::FilesystemService>().writeFileVector(fileDescriptor, vectors, count);
+}
+
+uint64_t copyFileRange(const int32_t sourceFileDescriptor, const uint64_t sourcePos,
+    const int32_t targetFileDescriptor, const uint64_t targetPos, const uint64_t length)
+{
+    auto &filesystemService = Kernel::Service::getService<Kernel::FilesystemService>();
+    return filesystemService.copyFileRange(sourceFileDescriptor, sourcePos, targetFileDescriptor, targetPos, length);
+}
+
 bool controlFile(const int32_t fileDescriptor, const size_t request, const Util::Array<size_t> &parameters) {
     auto &filesystemService = Kernel::Service::getService<Kernel::FilesystemService>();
     return filesystemService.getFileDescriptor(fileDescriptor).getNode().control(request, parameters);
@@ -203,6 +229,23 @@ bool createSharedMemory(const Util::String &name, void *startAddress, const size
     return processService.getCurrentProcess().createSharedMemory(name, startAddress, pageCount);
 }
 
+bool createIoRing(Util::Async::IoRing::Header &header, const size_t workerCount) {
+    auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
+    return processService.getCurrentProcess().createIoRing(header, workerCount);
+}
+
+size_t submitIoRing(Util::Async::IoRing::Header &header) {
+    auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
+    auto *ring = processService.getCurrentProcess().getIoRing(header);
+
+    return ring == nullptr ? 0 : ring->submit();
+}
+
+bool destroyIoRing(Util::Async::IoRing::Header &header) {
+    auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
+    return processService.getCurrentProcess().destroyIoRing(header);
+}
+
 int32_t createSocket(const Util::Network::Socket::Type socketType) {
     auto &networkService = Kernel::Service::getService<Kernel::NetworkService>();
     return networkService.createSocket(socketType);
@@ -250,16 +293,21 @@ Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util:
     return Util::Async::Process(process.getId());
 }
 
+Util::Async::Process cloneProcess(Util::Async::Runnable*, const Util::Io::File&, const Util::Io::File&, const Util::Io::File&) {
+    Util::Panic::fire(Util::Panic::UNSUPPORTED_OPERATION, "The kernel process cannot be cloned!");
+}
+
 Util::Async::Process getCurrentProcess() {
     auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
     const auto &process = processService.getCurrentProcess();
 
     return Util::Async::Process(process.getId());
 }
-Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable) {
+Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable, const uint32_t affinity) {
     auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
     auto &thread = Kernel::Thread::createKernelThread(name, processService.getKernelProcess(), runnable);
 
+    processService.getScheduler().setAffinity(thread, affinity);
     processService.getScheduler().ready(thread);
     return Util::Async::Thread(thread.getId());
 }
@@ -305,6 +353,27 @@ void sleep(const Util::Time::Timestamp &time) {
     }
 }
 
+bool setThreadNice(const size_t id, const int8_t nice) {
+    auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
+    auto *thread = processService.getScheduler().getThread(id);
+    if (thread == nullptr) {
+        return false;
+    }
+
+    processService.getScheduler().setNice(*thread, nice);
+    return true;
+}
+
+bool setThreadAffinity(const size_t id, const uint32_t affinity) {
+    auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
+    auto *thread = processService.getScheduler().getThread(id);
+    if (thread == nullptr) {
+        return false;
+    }
+
+    return processService.getScheduler().setAffinity(*thread, affinity);
+}
+
 void yield() {
     if (Kernel::Service::isServiceRegistered(Kernel::ProcessService::SERVICE_ID)) {
         auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
@@ -312,6 +381,28 @@ void yield() {
     }
 }
 
+bool waitOnAddress(const volatile uint32_t *address, const uint32_t expectedValue) {
+    if (!isSchedulerInitialized()) {
+        return false;
+    }
+
+    auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
+    return processService.getScheduler().waitOnAddress(address, expectedValue);
+}
+
+size_t wakeAddress(const volatile uint32_t *address, const size_t count) {
+    if (!isSchedulerInitialized()) {
+        return 0;
+    }
+
+    auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
+    return processService.getScheduler().wakeAddress(address, count);
+}
+
+bool isLockSleepingAllowed() {
+    return false;
+}
+
 bool isSchedulerInitialized() {
     if (!Kernel::Service::isServiceRegistered(Kernel::ProcessService::SERVICE_ID)) {
         return false;
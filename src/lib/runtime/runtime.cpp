@@ -5,6 +5,7 @@
 #include "lib/util/base/operators.h"
 #include "lib/util/base/Constants.h"
 #include "lib/util/base/FreeListMemoryManager.h"
+#include "lib/util/base/SegregatedFitMemoryManager.h"
 #include "lib/util/base/System.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/libc/time.h"
@@ -22,7 +23,10 @@ extern "C" void _fini();
 
 void initMemoryManager(uint8_t *startAddress) {
     new (&Util::System::getAddressSpaceHeader().heapMemoryManager) Util::FreeListMemoryManager(startAddress,
-		reinterpret_cast<void*>(Util::USER_SPACE_STACK_MEMORY_START_ADDRESS));
+		reinterpret_cast<void*>(Util::TIME_PAGE_ADDRESS));
+
+	new (&Util::System::getAddressSpaceHeader().allocationMemoryManager)
+		Util::SegregatedFitMemoryManager(Util::System::getAddressSpaceHeader().heapMemoryManager);
 
 	new (&Util::System::getAddressSpaceHeader().stackMemoryManager)
 		Util::BitmapMemoryManager(reinterpret_cast<uint8_t*>(Util::USER_SPACE_STACK_MEMORY_START_ADDRESS),
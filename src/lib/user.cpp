@@ -36,10 +36,11 @@
 #include "util/io/stream/PrintStream.h"
 #include "util/network/Socket.h"
 #include "util/time/Date.h"
+#include "util/time/TimePage.h"
 #include "util/time/Timestamp.h"
 
 void* allocateMemory(const size_t size, const size_t alignment) {
-    return Util::System::getAddressSpaceHeader().heapMemoryManager.allocateMemory(size, alignment);
+    return Util::System::getAddressSpaceHeader().allocationMemoryManager.allocateMemory(size, alignment);
 }
 
 void* reallocateMemory(void *pointer, const size_t size, const size_t alignment) {
@@ -47,20 +48,20 @@ void* reallocateMemory(void *pointer, const size_t size, const size_t alignment)
         return allocateMemory(size, alignment);
     }
 
-    return Util::System::getAddressSpaceHeader().heapMemoryManager.reallocateMemory(pointer, size, alignment);
+    return Util::System::getAddressSpaceHeader().allocationMemoryManager.reallocateMemory(pointer, size, alignment);
 }
 
 void freeMemory(void *pointer, const size_t alignment) {
-    Util::System::getAddressSpaceHeader().heapMemoryManager.freeMemory(pointer, alignment);
+    Util::System::getAddressSpaceHeader().allocationMemoryManager.freeMemory(pointer, alignment);
 }
 
 bool isMemoryManagementInitialized() {
     return true;
 }
 
-void* mapIO(const size_t physicalAddress, const size_t pageCount) {
+void* mapIO(const size_t physicalAddress, const size_t pageCount, const bool writeCombining) {
     void *mappedAddress;
-    Util::System::call(Util::System::MAP_IO, 3, physicalAddress, pageCount, &mappedAddress);
+    Util::System::call(Util::System::MAP_IO, 4, physicalAddress, pageCount, writeCombining, &mappedAddress);
 
     return mappedAddress;
 }
@@ -69,6 +70,18 @@ void unmap(void *virtualAddress, const size_t pageCount, const size_t breakCount
     Util::System::call(Util::System::UNMAP, 3, virtualAddress, pageCount, breakCount);
 }
 
+void* mapFile(const Util::String &path, const uint64_t offset, const size_t length, const bool readOnly) {
+    void *mappedAddress;
+    const auto result = Util::System::call(Util::System::MAP_FILE, 5, static_cast<const char*>(path),
+        offset, length, static_cast<uint32_t>(readOnly), &mappedAddress);
+
+    return result ? mappedAddress : nullptr;
+}
+
+bool unmapFile(void *virtualAddress) {
+    return Util::System::call(Util::System::UNMAP_FILE, 1, virtualAddress);
+}
+
 bool mount(const Util::String &deviceName, const Util::String &targetPath, const Util::String &driverName) {
     return Util::System::call(Util::System::MOUNT, 3,static_cast<const char*>(deviceName),
         static_cast<const char*>(targetPath), static_cast<const char*>(driverName));
@@ -143,6 +156,30 @@ uint64_t writeFile(const int32_t fileDescriptor, const uint8_t *sourceBuffer, co
     return written;
 }
 
+uint64_t readFileVector(const int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, const size_t count) {
+    uint64_t read;
+    Util::System::call(Util::System::READ_FILE_VECTOR, 4, fileDescriptor, vectors, count, &read);
+
+    return read;
+}
+
+uint64_t writeFileVector(const int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, const size_t count) {
+    uint64_t written;
+    Util::System::call(Util::System::WRITE_FILE_VECTOR, 4, fileDescriptor, vectors, count, &written);
+
+    return written;
+}
+
+uint64_t copyFileRange(const int32_t sourceFileDescriptor, const uint64_t sourcePos,
+    const int32_t targetFileDescriptor, const uint64_t targetPos, const uint64_t length)
+{
+    uint64_t copied;
+    Util::System::call(Util::System::COPY_FILE_RANGE, 6, sourceFileDescriptor, sourcePos,
+        targetFileDescriptor, targetPos, length, &copied);
+
+    return copied;
+}
+
 bool controlFile(const int32_t fileDescriptor, const size_t request, const Util::Array<size_t> &parameters) {
     return Util::System::call(Util::System::CONTROL_FILE, 3, fileDescriptor, request, &parameters);
 }
@@ -172,6 +209,21 @@ bool createSharedMemory(const Util::String &name, void *startAddress, const size
         static_cast<const char*>(name), startAddress, pageCount);
 }
 
+bool createIoRing(Util::Async::IoRing::Header &header, const size_t workerCount) {
+    return Util::System::call(Util::System::CREATE_IO_RING, 2, &header, workerCount);
+}
+
+size_t submitIoRing(Util::Async::IoRing::Header &header) {
+    size_t pending = 0;
+    Util::System::call(Util::System::SUBMIT_IO_RING, 2, &header, &pending);
+
+    return pending;
+}
+
+bool destroyIoRing(Util::Async::IoRing::Header &header) {
+    return Util::System::call(Util::System::DESTROY_IO_RING, 1, &header);
+}
+
 int32_t createSocket(const Util::Network::Socket::Type socketType) {
     int32_t fileDescriptor;
     const auto result = Util::System::call(Util::System::CREATE_SOCKET, 2,
@@ -199,6 +251,23 @@ Util::Async::Process executeBinary(const Util::Io::File &binaryFile, const Util:
     return Util::Async::Process(processId);
 }
 
+void kickoffClonedProcess(Util::Async::Runnable *runnable) {
+    runnable->run();
+
+    delete runnable;
+    Util::System::call(Util::System::EXIT_PROCESS, 1, 0);
+}
+
+Util::Async::Process cloneProcess(Util::Async::Runnable *runnable, const Util::Io::File &inputFile,
+    const Util::Io::File &outputFile, const Util::Io::File &errorFile)
+{
+    size_t processId;
+    Util::System::call(Util::System::CLONE_PROCESS, 6,
+        runnable, kickoffClonedProcess, &inputFile, &outputFile, &errorFile, &processId);
+
+    return Util::Async::Process(processId);
+}
+
 Util::Async::Process getCurrentProcess() {
     size_t processId;
     Util::System::call(Util::System::GET_CURRENT_PROCESS, 1, &processId);
@@ -213,10 +282,10 @@ void kickoffUserThread(Util::Async::Runnable *runnable) {
     Util::System::call(Util::System::EXIT_THREAD, 0);
 }
 
-Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable) {
+Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable, const uint32_t affinity) {
     size_t threadId;
-    Util::System::call(Util::System::CREATE_THREAD, 4,
-        static_cast<const char*>(name), runnable, kickoffUserThread, &threadId);
+    Util::System::call(Util::System::CREATE_THREAD, 5,
+        static_cast<const char*>(name), runnable, kickoffUserThread, &threadId, affinity);
 
     return Util::Async::Thread(threadId);
 }
@@ -244,22 +313,100 @@ void sleep(const Util::Time::Timestamp &time) {
     Util::System::call(Util::System::SLEEP, 1, &time);
 }
 
+bool setThreadNice(const size_t id, const int8_t nice) {
+    return Util::System::call(Util::System::SET_THREAD_NICE, 2, id, static_cast<int32_t>(nice));
+}
+
+bool setThreadAffinity(const size_t id, const uint32_t affinity) {
+    return Util::System::call(Util::System::SET_THREAD_AFFINITY, 2, id, affinity);
+}
+
 void yield() {
     Util::System::call(Util::System::YIELD, 0);
 }
 
+bool waitOnAddress(const volatile uint32_t *address, const uint32_t expectedValue) {
+    return Util::System::call(Util::System::WAIT_ON_ADDRESS, 2, address, expectedValue);
+}
+
+size_t wakeAddress(const volatile uint32_t *address, const size_t count) {
+    size_t wokenThreads = 0;
+    Util::System::call(Util::System::WAKE_ADDRESS, 3, address, count, &wokenThreads);
+
+    return wokenThreads;
+}
+
+bool isLockSleepingAllowed() {
+    return true;
+}
+
 bool isSchedulerInitialized() {
     return true;
 }
 
+/// Copy the time page, which is mapped read-only into every user space and updated by the kernel.
+/// The copy is retried until it has not been interrupted by an update (indicated by a changed or odd sequence counter).
+static void readTimePage(Util::Time::TimePage &snapshot) {
+    const auto &timePage = *reinterpret_cast<const Util::Time::TimePage*>(Util::TIME_PAGE_ADDRESS);
+    uint32_t sequence;
+
+    do {
+        sequence = timePage.sequence;
+        asm volatile ("" : : : "memory");
+
+        snapshot.flags = timePage.flags;
+        snapshot.tickCount = timePage.tickCount;
+        snapshot.counterAddress = timePage.counterAddress;
+        snapshot.systemTime = timePage.systemTime;
+        snapshot.counterValue = timePage.counterValue;
+        snapshot.counterMaxValue = timePage.counterMaxValue;
+        snapshot.femtosecondsPerTick = timePage.femtosecondsPerTick;
+        snapshot.unixTime = timePage.unixTime;
+
+        asm volatile ("" : : : "memory");
+    } while ((sequence & 0x01) != 0 || timePage.sequence != sequence);
+
+    snapshot.sequence = sequence;
+}
+
 Util::Time::Timestamp getSystemTime() {
-    Util::Time::Timestamp systemTime;
-    Util::System::call(Util::System::GET_SYSTEM_TIME, 1, &systemTime);
+    Util::Time::TimePage timePage{};
+    readTimePage(timePage);
+
+    if ((timePage.flags & Util::Time::TimePage::SYSTEM_TIME_VALID) == 0) {
+        Util::Time::Timestamp systemTime;
+        Util::System::call(Util::System::GET_SYSTEM_TIME, 1, &systemTime);
+
+        return systemTime;
+    }
+
+    if (timePage.femtosecondsPerTick == 0) {
+        return Util::Time::Timestamp::ofNanoseconds(timePage.systemTime);
+    }
+
+    // Interpolate the time since the last update by reading the system timer's counter (low, high, high again to detect a carry)
+    const auto *counter = reinterpret_cast<const volatile uint32_t*>(timePage.counterAddress);
+    uint32_t counterLow, counterHigh, counterHighAfter;
+    do {
+        counterHigh = counter[1];
+        counterLow = counter[0];
+        counterHighAfter = counter[1];
+    } while (counterHigh != counterHighAfter);
 
-    return systemTime;
+    const auto counterValue = counterLow | (static_cast<uint64_t>(counterHigh) << 32);
+    const auto ticks = counterValue >= timePage.counterValue ? counterValue - timePage.counterValue : timePage.counterMaxValue - timePage.counterValue + counterValue;
+
+    return Util::Time::Timestamp::ofNanoseconds(timePage.systemTime + (ticks * timePage.femtosecondsPerTick) / 1000000);
 }
 
 Util::Time::Date getCurrentDate() {
+    Util::Time::TimePage timePage{};
+    readTimePage(timePage);
+
+    if ((timePage.flags & Util::Time::TimePage::DATE_VALID) != 0) {
+        return Util::Time::Date(timePage.unixTime);
+    }
+
     auto date = Util::Time::Date(0);
     Util::System::call(Util::System::GET_CURRENT_DATE, 1, &date);
 
@@ -27,14 +27,34 @@
 namespace Util {
 namespace Async {
 
-AtomicBitmap::AtomicBitmap(const size_t blockCount) : blocks(blockCount) {
+AtomicBitmap::AtomicBitmap(const size_t blockCount) : blocks(blockCount), freeBlocks(blockCount) {
     arraySize = blockCount % SIZE_BITS == 0 ? blockCount / SIZE_BITS : blockCount / SIZE_BITS + 1;
+    summarySize = arraySize % SIZE_BITS == 0 ? arraySize / SIZE_BITS : arraySize / SIZE_BITS + 1;
+
     bitmap = new size_t[arraySize];
+    summary = new size_t[summarySize];
     Address(bitmap).setRange(0, arraySize * sizeof(size_t));
+    Address(summary).setRange(0, summarySize * sizeof(size_t));
+
+    if (arraySize == 0) {
+        return;
+    }
+
+    // Bits behind the last block are marked as used, so that the last word can become full
+    const size_t lastWordBits = blockCount - (arraySize - 1) * SIZE_BITS;
+    lastWordMask = lastWordBits == SIZE_BITS ? SIZE_MAX : ~(SIZE_MAX >> lastWordBits);
+    bitmap[arraySize - 1] = ~lastWordMask;
+
+    // Summary bits behind the last word are marked as full, so that they are skipped by the search
+    const size_t lastSummaryBits = arraySize - (summarySize - 1) * SIZE_BITS;
+    if (lastSummaryBits < SIZE_BITS) {
+        summary[summarySize - 1] = SIZE_MAX << lastSummaryBits;
+    }
 }
 
 AtomicBitmap::~AtomicBitmap() {
     delete[] bitmap;
+    delete[] summary;
 }
 
 void AtomicBitmap::set(const size_t block) const {
@@ -46,7 +66,13 @@ void AtomicBitmap::set(const size_t block) const {
     const size_t bit = block % SIZE_BITS;
 
     Atomic<size_t> bitmapWrapper(bitmap[index]);
-    bitmapWrapper.bitSet(SIZE_BITS - 1 - bit);
+    if (!bitmapWrapper.bitTestAndSet(SIZE_BITS - 1 - bit)) {
+        Atomic<size_t>(freeBlocks).dec();
+
+        if (bitmapWrapper.get() == SIZE_MAX) {
+            markFull(index);
+        }
+    }
 }
 
 void AtomicBitmap::unset(const size_t block) const {
@@ -58,7 +84,10 @@ void AtomicBitmap::unset(const size_t block) const {
     const size_t bit = block % SIZE_BITS;
 
     Atomic<size_t> bitmapWrapper(bitmap[index]);
-    bitmapWrapper.bitUnset(SIZE_BITS - 1 - bit);
+    if (bitmapWrapper.bitTestAndUnset(SIZE_BITS - 1 - bit)) {
+        markNotFull(index);
+        Atomic<size_t>(freeBlocks).inc();
+    }
 }
 
 bool AtomicBitmap::check(const size_t block) const {
@@ -74,35 +103,113 @@ bool AtomicBitmap::check(const size_t block) const {
 }
 
 size_t AtomicBitmap::findAndSet() const {
-    size_t i;
+    if (Atomic<size_t>(freeBlocks).get() == 0) {
+        return INVALID_INDEX;
+    }
 
-    for (i = 0; i < blocks; i++) {
-        const size_t index = i / SIZE_BITS;
-        const size_t bit = i % SIZE_BITS;
+    // Next-fit: Search from the word of the last allocation to the end and wrap around afterward
+    const auto startWord = Atomic<size_t>(nextFitWord).get();
+    const auto block = findAndSet(startWord, arraySize);
 
-        Atomic<size_t> bitmapWrapper(bitmap[index]);
-        if (!bitmapWrapper.bitTestAndSet(SIZE_BITS - 1 - bit)) {
-            break;
+    return block == INVALID_INDEX ? findAndSet(0, startWord) : block;
+}
+
+size_t AtomicBitmap::findAndUnset() const {
+    if (Atomic<size_t>(freeBlocks).get() == blocks) {
+        return INVALID_INDEX;
+    }
+
+    for (size_t i = 0; i < arraySize; i++) {
+        Atomic<size_t> bitmapWrapper(bitmap[i]);
+        const auto mask = i == arraySize - 1 ? lastWordMask : SIZE_MAX;
+
+        // Empty words are skipped with a plain read; the loop only repeats if another thread unset a bit in between
+        for (auto word = bitmapWrapper.get() & mask; word != 0; word = bitmapWrapper.get() & mask) {
+            const auto bit = static_cast<size_t>(__builtin_clzl(word));
+            if (bitmapWrapper.bitTestAndUnset(SIZE_BITS - 1 - bit)) {
+                markNotFull(i);
+                Atomic<size_t>(freeBlocks).inc();
+
+                return i * SIZE_BITS + bit;
+            }
         }
     }
 
-    return i == blocks ? INVALID_INDEX : i;
+    return INVALID_INDEX;
 }
 
-size_t AtomicBitmap::findAndUnset() const {
-    size_t i;
+size_t AtomicBitmap::getFreeBlocks() const {
+    return Atomic<size_t>(freeBlocks).get();
+}
 
-    for (i = 0; i < blocks; i++) {
-        const size_t index = i / SIZE_BITS;
-        const size_t bit = i % SIZE_BITS;
+size_t AtomicBitmap::findAndSet(const size_t startWord, const size_t endWord) const {
+    auto wordIndex = startWord;
 
-        Atomic<size_t> bitmapWrapper(bitmap[index]);
-        if (bitmapWrapper.bitTestAndUnset(SIZE_BITS - 1 - bit)) {
+    while (wordIndex < endWord) {
+        // Look up the words, that are not full, starting at the current word
+        const auto summaryBit = wordIndex % SIZE_BITS;
+        const auto candidates = ~Atomic<size_t>(summary[wordIndex / SIZE_BITS]).get() >> summaryBit;
+
+        if (candidates == 0) {
+            // All remaining words covered by this summary word are full
+            wordIndex += SIZE_BITS - summaryBit;
+            continue;
+        }
+
+        wordIndex += static_cast<size_t>(__builtin_ctzl(candidates));
+        if (wordIndex >= endWord) {
             break;
         }
+
+        const auto block = findAndSetInWord(wordIndex);
+        if (block != INVALID_INDEX) {
+            return block;
+        }
+
+        wordIndex++;
+    }
+
+    return INVALID_INDEX;
+}
+
+size_t AtomicBitmap::findAndSetInWord(const size_t wordIndex) const {
+    Atomic<size_t> bitmapWrapper(bitmap[wordIndex]);
+
+    // Each failed attempt means that another thread has set a bit in this word, so the loop is bounded
+    for (auto word = bitmapWrapper.get(); word != SIZE_MAX; word = bitmapWrapper.get()) {
+        const auto bit = static_cast<size_t>(__builtin_clzl(~word));
+        if (!bitmapWrapper.bitTestAndSet(SIZE_BITS - 1 - bit)) {
+            Atomic<size_t>(freeBlocks).dec();
+            Atomic<size_t>(nextFitWord).set(wordIndex);
+
+            if (bitmapWrapper.get() == SIZE_MAX) {
+                markFull(wordIndex);
+            }
+
+            return wordIndex * SIZE_BITS + bit;
+        }
     }
 
-    return i == blocks ? INVALID_INDEX : i;
+    markFull(wordIndex);
+    return INVALID_INDEX;
+}
+
+void AtomicBitmap::markFull(const size_t wordIndex) const {
+    Atomic<size_t> summaryWrapper(summary[wordIndex / SIZE_BITS]);
+    summaryWrapper.bitSet(wordIndex % SIZE_BITS);
+
+    // A bit may have been unset after the word was found full, but before the summary bit was set
+    const volatile size_t &word = bitmap[wordIndex];
+    if (word != SIZE_MAX) {
+        summaryWrapper.bitUnset(wordIndex % SIZE_BITS);
+    }
+}
+
+void AtomicBitmap::markNotFull(const size_t wordIndex) const {
+    Atomic<size_t> summaryWrapper(summary[wordIndex / SIZE_BITS]);
+    if (summaryWrapper.bitTest(wordIndex % SIZE_BITS)) {
+        summaryWrapper.bitUnset(wordIndex % SIZE_BITS);
+    }
 }
 
 }
@@ -29,6 +29,10 @@ namespace Async {
 
 /// A bitmap that can be used to manage a set of blocks (e.g. page frames).
 /// It uses atomic operations to ensure thread-safety.
+/// A second level summary bitmap keeps one bit per word of the bitmap, which is set if the word is full.
+/// Together with a next-fit hint, this allows `findAndSet()` to skip full words (and whole ranges of full words)
+/// without issuing a locked operation for each bit. The number of unset bits is maintained atomically,
+/// so querying it does not require scanning the bitmap.
 ///
 /// ## Example
 /// ```c++
@@ -74,7 +78,8 @@ public:
     /// If the index is out of bounds, a panic is fired.
     bool check(size_t block) const;
 
-    /// Find the first unset bit and set it to 1.
+    /// Find an unset bit and set it to 1.
+    /// The search starts at the word, in which the last bit has been found (next-fit) and wraps around.
     /// Return the index of the bit that was set or INVALID_INDEX if no unset bit was found.
     size_t findAndSet() const;
 
@@ -82,14 +87,37 @@ public:
     /// Return the index of the bit that was unset or INVALID_INDEX if no set bit was found.
     size_t findAndUnset() const;
 
+    /// Get the number of unset bits in the bitmap.
+    size_t getFreeBlocks() const;
+
     /// Indicates that no suitable bit was found.
     static constexpr size_t INVALID_INDEX = SIZE_MAX;
 
 private:
 
+    /// Search the words in the range [startWord, endWord) for an unset bit and set it to 1.
+    /// Full words are skipped by looking at the summary bitmap.
+    size_t findAndSet(size_t startWord, size_t endWord) const;
+
+    /// Try to set an unset bit in the given word. If the word is full, it is marked as full in the summary bitmap.
+    size_t findAndSetInWord(size_t wordIndex) const;
+
+    /// Mark a word as full in the summary bitmap.
+    /// The word is checked again afterward, to not lose blocks that have been unset in the meantime.
+    void markFull(size_t wordIndex) const;
+
+    /// Mark a word as not full in the summary bitmap.
+    void markNotFull(size_t wordIndex) const;
+
     size_t *bitmap = nullptr;
+    size_t *summary = nullptr;
     size_t arraySize = 0;
+    size_t summarySize = 0;
     size_t blocks = 0;
+    size_t lastWordMask = 0;
+
+    mutable size_t freeBlocks = 0;
+    mutable size_t nextFitWord = 0;
 
     static constexpr size_t SIZE_BITS = sizeof(size_t) * 8;
 };
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ConditionVariable.h"
+
+#include "util/async/Lock.h"
+#include "util/async/Thread.h"
+
+namespace Util {
+namespace Async {
+
+void ConditionVariable::wait(Lock &lock) {
+    // The sequence number is read while still holding the lock. If another thread signals the condition variable
+    // after the lock has been released, the sequence number has changed and `waitOnAddress()` returns immediately.
+    waitingWrapper.inc();
+    const auto currentSequence = sequenceWrapper.get();
+    lock.release();
+
+    Thread::waitOnAddress(&sequence, currentSequence);
+
+    waitingWrapper.dec();
+    lock.acquire();
+}
+
+void ConditionVariable::signal() {
+    notify(1);
+}
+
+void ConditionVariable::signalAll() {
+    notify(UINT32_MAX);
+}
+
+void ConditionVariable::notify(uint32_t count) {
+    sequenceWrapper.inc();
+    if (waitingWrapper.get() > 0) {
+        Thread::wakeAddress(&sequence, count);
+    }
+}
+
+}
+}
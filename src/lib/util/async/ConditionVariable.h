@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LIB_UTIL_ASYNC_CONDITIONVARIABLE_H
+#define HHUOS_LIB_UTIL_ASYNC_CONDITIONVARIABLE_H
+
+#include <stdint.h>
+
+#include "util/async/Atomic.h"
+
+namespace Util {
+namespace Async {
+class Lock;
+
+/// A condition variable, that lets threads sleep until another thread signals a change of some shared state.
+/// The shared state must be protected by a lock (usually a `Util::Async::Mutex`), which is released while waiting.
+/// Like `Util::Async::Mutex`, it is based on `Thread::waitOnAddress()` and must not be used in interrupt handlers.
+/// Spurious wakeups are possible, so the condition must always be checked again in a loop.
+///
+/// ## Example
+///
+/// ```c++
+/// Util::ArrayList<int> list; // Global list, shared between producer and consumer
+/// Util::Async::Mutex mutex; // Mutex to synchronize access to the list
+/// Util::Async::ConditionVariable notEmpty; // Condition variable to signal that the list is not empty
+///
+/// // Producer
+/// mutex.acquire();
+/// list.add(42);
+/// notEmpty.signal();
+/// mutex.release();
+///
+/// // Consumer
+/// mutex.acquire();
+/// while (list.isEmpty()) {
+///     notEmpty.wait(mutex);
+/// }
+///
+/// const auto value = list.removeIndex(0);
+/// mutex.release();
+/// ```
+class ConditionVariable {
+
+public:
+    /// Create a new condition variable.
+    ConditionVariable() = default;
+
+    /// Condition variables should not be copied, since copies would not operate on the same value.
+    ConditionVariable(const ConditionVariable &copy) = delete;
+
+    /// Condition variables should not be copied, since copies would not operate on the same value.
+    ConditionVariable& operator=(const ConditionVariable &other) = delete;
+
+    /// Destructor.
+    ~ConditionVariable() = default;
+
+    /// Atomically release the given lock and sleep until the condition variable is signaled.
+    /// The lock must be held by the calling thread and is acquired again, before this function returns.
+    void wait(Lock &lock);
+
+    /// Wake up one thread, that is waiting on this condition variable.
+    void signal();
+
+    /// Wake up all threads, that are waiting on this condition variable.
+    void signalAll();
+
+private:
+
+    void notify(uint32_t count);
+
+    uint32_t sequence = 0;
+    uint32_t waitingThreads = 0;
+    Atomic<uint32_t> sequenceWrapper = Atomic<uint32_t>(sequence);
+    Atomic<uint32_t> waitingWrapper = Atomic<uint32_t>(waitingThreads);
+};
+
+}
+}
+
+#endif
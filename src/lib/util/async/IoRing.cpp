@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "IoRing.h"
+
+#include "interface.h"
+#include "util/async/Thread.h"
+#include "util/base/Panic.h"
+#include "util/network/Datagram.h"
+#include "util/time/Timestamp.h"
+
+namespace Util {
+namespace Async {
+
+IoRing::IoRing(const uint32_t entryCount, const uint32_t workerCount) {
+    if (entryCount == 0 || (entryCount & (entryCount - 1)) != 0) {
+        Panic::fire(Panic::INVALID_ARGUMENT, "IoRing: Entry count must be a power of two!");
+    }
+
+    const auto size = sizeof(Header) + entryCount * (sizeof(SubmissionEntry) + sizeof(CompletionEntry));
+    auto *memory = static_cast<uint8_t*>(allocateMemory(size, sizeof(uint64_t)));
+
+    header = reinterpret_cast<Header*>(memory);
+    submissionEntries = reinterpret_cast<SubmissionEntry*>(memory + sizeof(Header));
+    completionEntries = reinterpret_cast<CompletionEntry*>(submissionEntries + entryCount);
+
+    header->submissionHead = 0;
+    header->submissionTail = 0;
+    header->completionHead = 0;
+    header->completionTail = 0;
+    header->entryCount = entryCount;
+
+    if (!createIoRing(*header, workerCount)) {
+        Panic::fire(Panic::ILLEGAL_STATE, "IoRing: Failed to register ring!");
+    }
+}
+
+IoRing::~IoRing() {
+    destroyIoRing(*header);
+    freeMemory(header, sizeof(uint64_t));
+}
+
+bool IoRing::prepareRead(const int32_t fileDescriptor, void *buffer, const uint64_t offset, const uint64_t length, const size_t userData) {
+    return prepare(READ, fileDescriptor, buffer, offset, length, userData);
+}
+
+bool IoRing::prepareWrite(const int32_t fileDescriptor, const void *buffer, const uint64_t offset, const uint64_t length, const size_t userData) {
+    return prepare(WRITE, fileDescriptor, const_cast<void*>(buffer), offset, length, userData);
+}
+
+bool IoRing::prepareSend(const int32_t fileDescriptor, const Network::Datagram &datagram, const size_t userData) {
+    return prepare(SEND, fileDescriptor, const_cast<Network::Datagram*>(&datagram), 0, 0, userData);
+}
+
+bool IoRing::prepareReceive(const int32_t fileDescriptor, Network::Datagram &datagram, const size_t userData) {
+    return prepare(RECEIVE, fileDescriptor, &datagram, 0, 0, userData);
+}
+
+bool IoRing::prepareTimeout(const Time::Timestamp &timeout, const size_t userData) {
+    return prepare(TIMEOUT, -1, nullptr, timeout.toNanoseconds(), 0, userData);
+}
+
+uint32_t IoRing::submit() {
+    // Entries must be completely written, before the kernel can see the new tail
+    asm volatile ("" : : : "memory");
+    header->submissionTail = preparedTail;
+
+    return submitIoRing(*header);
+}
+
+bool IoRing::pollCompletion(CompletionEntry &completion) {
+    const uint32_t head = header->completionHead;
+    if (head == header->completionTail) {
+        return false;
+    }
+
+    asm volatile ("" : : : "memory");
+    completion = completionEntries[head & (header->entryCount - 1)];
+    asm volatile ("" : : : "memory");
+
+    // The kernel may reuse the entry, as soon as the head has been advanced
+    header->completionHead = head + 1;
+    return true;
+}
+
+IoRing::CompletionEntry IoRing::waitForCompletion() {
+    CompletionEntry completion{};
+
+    while (!pollCompletion(completion)) {
+        // Sleep until the kernel advances the tail (returns immediately, if it has changed meanwhile)
+        Thread::waitOnAddress(&header->completionTail, header->completionHead);
+    }
+
+    return completion;
+}
+
+uint32_t IoRing::getCompletionCount() const {
+    return header->completionTail - header->completionHead;
+}
+
+bool IoRing::prepare(const Operation operation, const int32_t fileDescriptor, void *buffer, const uint64_t offset, const uint64_t length, const size_t userData) {
+    if (preparedTail - header->submissionHead >= header->entryCount) {
+        return false;
+    }
+
+    submissionEntries[preparedTail & (header->entryCount - 1)] = { operation, fileDescriptor, buffer, offset, length, userData };
+    preparedTail++;
+
+    return true;
+}
+
+}
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LIB_UTIL_ASYNC_IORING_H
+#define HHUOS_LIB_UTIL_ASYNC_IORING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Util {
+namespace Network {
+class Datagram;
+}  // namespace Network
+
+namespace Time {
+class Timestamp;
+}  // namespace Time
+}  // namespace Util
+
+namespace Util {
+namespace Async {
+
+/// An interface for asynchronous file and socket I/O, based on a submission queue and a completion queue,
+/// which are shared between the process and the kernel (similar to io_uring on Linux).
+/// Operations are placed in the submission queue and handed to the kernel in batches via `submit()`,
+/// which only needs one system call, regardless of how many operations are submitted.
+/// The kernel executes the operations with its own worker threads, so multiple disk and network requests
+/// can be in flight at the same time, while the submitting thread continues to run.
+/// Each finished operation is placed in the completion queue, together with the `userData` value given on submission.
+///
+/// Both queues are ring buffers with the same amount of entries. The kernel never starts more operations,
+/// than there is space in the completion queue, so completions can never get lost.
+/// Operations, that did not fit into the completion queue, are started with the next call of `submit()`.
+/// Buffers and datagrams passed to an operation must stay valid, until its completion has been received.
+///
+/// ### Example
+/// ```c++
+/// auto ring = Util::Async::IoRing(16);
+/// uint8_t header[512];
+/// uint8_t payload[4096];
+///
+/// // Read the header and the payload of a file concurrently
+/// ring.prepareRead(fileDescriptor, header, 0, sizeof(header), 1);
+/// ring.prepareRead(fileDescriptor, payload, sizeof(header), sizeof(payload), 2);
+/// ring.submit();
+///
+/// for (uint32_t i = 0; i < 2; i++) {
+///     const auto completion = ring.waitForCompletion();
+///     Util::System::out << "Operation " << completion.userData << " read " << completion.result << " bytes" << Util::Io::PrintStream::lnFlush;
+/// }
+/// ```
+class IoRing {
+
+public:
+    /// The operations, which can be submitted to an I/O ring.
+    enum Operation : uint32_t {
+        /// Read `length` bytes at position `offset` from a file into `buffer`.
+        READ,
+        /// Write `length` bytes from `buffer` to position `offset` of a file.
+        WRITE,
+        /// Send the `Util::Network::Datagram` pointed to by `buffer` via a socket.
+        SEND,
+        /// Receive a datagram from a socket into the `Util::Network::Datagram` pointed to by `buffer`.
+        RECEIVE,
+        /// Complete after `offset` nanoseconds have passed.
+        TIMEOUT
+    };
+
+    /// An entry of the submission queue, written by the process and read by the kernel.
+    struct SubmissionEntry {
+        Operation operation;
+        int32_t fileDescriptor;
+        void *buffer;
+        uint64_t offset;
+        uint64_t length;
+        size_t userData;
+    };
+
+    /// An entry of the completion queue, written by the kernel and read by the process.
+    struct CompletionEntry {
+        /// The value given on submission of the operation.
+        size_t userData;
+        /// The amount of bytes read or written (or received/sent for socket operations).
+        uint64_t result;
+        /// False, if the operation failed (e.g. a non-blocking socket had no datagram available).
+        bool success;
+    };
+
+    /// The start of the shared ring memory, followed by the submission queue entries
+    /// and then the completion queue entries. The indices are only ever incremented
+    /// and wrap around at `UINT32_MAX` (entries are accessed modulo `entryCount`, which is a power of two).
+    struct Header {
+        /// The index of the next submission entry to be taken by the kernel (written by the kernel).
+        volatile uint32_t submissionHead;
+        /// The index after the last submitted entry (written by the process).
+        volatile uint32_t submissionTail;
+        /// The index of the next completion entry to be received (written by the process).
+        volatile uint32_t completionHead;
+        /// The index after the last completion entry (written by the kernel).
+        /// Threads waiting for completions sleep on this address (see `Thread::waitOnAddress()`).
+        volatile uint32_t completionTail;
+        /// The amount of entries in each queue.
+        uint32_t entryCount;
+    };
+
+    /// The amount of kernel worker threads used by default, which is also the maximum amount of operations executed at the same time.
+    static constexpr uint32_t DEFAULT_WORKER_COUNT = 4;
+
+    /// Create a new I/O ring with `entryCount` entries per queue (must be a power of two)
+    /// and register it at the kernel, which starts `workerCount` worker threads for it.
+    explicit IoRing(uint32_t entryCount, uint32_t workerCount = DEFAULT_WORKER_COUNT);
+
+    /// IoRing is not copyable, since the kernel keeps working on its memory.
+    IoRing(const IoRing &other) = delete;
+
+    /// IoRing is not copyable, since the kernel keeps working on its memory.
+    IoRing &operator=(const IoRing &other) = delete;
+
+    /// Unregister the ring from the kernel, which waits for all running operations to finish, and free its memory.
+    /// Operations, that have been submitted but not yet started, are discarded.
+    ~IoRing();
+
+    /// Queue an asynchronous read. Return false, if the submission queue is full.
+    bool prepareRead(int32_t fileDescriptor, void *buffer, uint64_t offset, uint64_t length, size_t userData);
+
+    /// Queue an asynchronous write. Return false, if the submission queue is full.
+    bool prepareWrite(int32_t fileDescriptor, const void *buffer, uint64_t offset, uint64_t length, size_t userData);
+
+    /// Queue sending a datagram via a socket. Return false, if the submission queue is full.
+    bool prepareSend(int32_t fileDescriptor, const Network::Datagram &datagram, size_t userData);
+
+    /// Queue receiving a datagram from a socket. Return false, if the submission queue is full.
+    bool prepareReceive(int32_t fileDescriptor, Network::Datagram &datagram, size_t userData);
+
+    /// Queue a timeout, which completes after the given time. Return false, if the submission queue is full.
+    bool prepareTimeout(const Time::Timestamp &timeout, size_t userData);
+
+    /// Hand all prepared operations to the kernel with a single system call.
+    /// Return the amount of submitted operations, which have not been started by the kernel yet.
+    uint32_t submit();
+
+    /// Take the next entry from the completion queue, without blocking.
+    /// Return false, if no operation has completed yet.
+    bool pollCompletion(CompletionEntry &completion);
+
+    /// Take the next entry from the completion queue, sleeping until an operation has completed, if necessary.
+    /// At least one operation must have been submitted before, or this blocks forever.
+    CompletionEntry waitForCompletion();
+
+    /// Get the amount of entries in the completion queue, which have not been taken yet.
+    uint32_t getCompletionCount() const;
+
+private:
+
+    bool prepare(Operation operation, int32_t fileDescriptor, void *buffer, uint64_t offset, uint64_t length, size_t userData);
+
+    Header *header;
+    SubmissionEntry *submissionEntries;
+    CompletionEntry *completionEntries;
+    uint32_t preparedTail = 0;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Mutex.h"
+
+#include "util/async/Thread.h"
+
+namespace Util {
+namespace Async {
+
+void Mutex::acquire() {
+    for (uint32_t i = 0; i < SPIN_ATTEMPTS; i++) {
+        if (tryAcquire()) {
+            return;
+        }
+    }
+
+    // Mark the mutex as contended, so that the thread releasing it knows that it has to wake up a waiting thread.
+    // Since we cannot know whether other threads are still waiting, the mutex stays contended after we acquired it.
+    while (stateWrapper.getAndSet(LOCKED_CONTENDED) != UNLOCKED) {
+        Thread::waitOnAddress(&state, LOCKED_CONTENDED);
+    }
+}
+
+bool Mutex::tryAcquire() {
+    return stateWrapper.compareAndSet(UNLOCKED, LOCKED);
+}
+
+void Mutex::release() {
+    if (stateWrapper.getAndSet(UNLOCKED) == LOCKED_CONTENDED) {
+        Thread::wakeAddress(&state);
+    }
+}
+
+bool Mutex::isLocked() const {
+    return stateWrapper.get() != UNLOCKED;
+}
+
+}
+}
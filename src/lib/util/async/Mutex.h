@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LIB_UTIL_ASYNC_MUTEX_H
+#define HHUOS_LIB_UTIL_ASYNC_MUTEX_H
+
+#include <stdint.h>
+
+#include "util/async/Atomic.h"
+#include "util/async/Lock.h"
+
+namespace Util {
+namespace Async {
+
+/// A mutual exclusion lock, that puts contending threads to sleep instead of letting them spin.
+/// It is implemented on top of `Thread::waitOnAddress()` and `Thread::wakeAddress()` and works in kernel and user space.
+/// As long as no thread is waiting for the lock, acquiring and releasing it does not cause any system call.
+/// Since waiting threads are blocked in the scheduler, a mutex must never be used in interrupt handlers.
+/// A mutex is not reentrant, so a thread must not acquire a mutex it already holds.
+///
+/// ## Example
+///
+/// ```c++
+/// Util::ArrayList<int> list; // Global list, shared between multiple threads
+/// Util::Async::Mutex mutex; // Mutex to synchronize access to the list
+///
+/// // Function that runs in multiple threads.
+/// void threadFunction() {
+///     mutex.acquire();
+///     list.add(42); // Only one thread can add to the list at a time
+///     mutex.release();
+/// }
+/// ```
+class Mutex : public Lock {
+
+public:
+    /// Create a new unlocked mutex.
+    Mutex() = default;
+
+    /// Acquire the mutex.
+    /// The mutex is tried a few times first, since its holder may be about to release it on another CPU.
+    /// Afterward, the calling thread sleeps until the mutex is released.
+    void acquire() override;
+
+    /// Try to acquire the mutex once.
+    /// If the mutex is not available, the function does not block and returns false.
+    bool tryAcquire() override;
+
+    /// Release the mutex and wake up one waiting thread (if any).
+    /// If the mutex is not held, this function does nothing.
+    void release() override;
+
+    /// Check if the mutex is currently held.
+    bool isLocked() const override;
+
+private:
+
+    uint32_t state = UNLOCKED;
+    Atomic<uint32_t> stateWrapper = Atomic<uint32_t>(state);
+
+    static constexpr uint32_t UNLOCKED = 0;
+    static constexpr uint32_t LOCKED = 1;
+    static constexpr uint32_t LOCKED_CONTENDED = 2;
+    static constexpr uint32_t SPIN_ATTEMPTS = 100;
+};
+
+}
+}
+
+#endif
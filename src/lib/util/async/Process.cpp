@@ -42,6 +42,10 @@ Process Process::execute(const Io::File &binaryFile, const Io::File &inputFile,
     return executeBinary(binaryFile, inputFile, outputFile, errorFile, command, arguments);
 }
 
+Process Process::clone(Runnable *runnable, const Io::File &inputFile, const Io::File &outputFile, const Io::File &errorFile) {
+    return cloneProcess(runnable, inputFile, outputFile, errorFile);
+}
+
 Process Process::getCurrentProcess() {
     return ::getCurrentProcess();
 }
@@ -30,6 +30,8 @@
 namespace Util {
 namespace Async {
 
+class Runnable;
+
 /// Create and manipulate processes from the user space.
 /// This class just wraps a process ID and uses systems calls to manipulate the process referenced by the ID.
 class Process {
@@ -56,6 +58,33 @@ public:
     static Process execute(const Io::File &binaryFile, const Io::File &inputFile, const Io::File &outputFile,
         const Io::File &errorFile, const String &command, const Array<String> &arguments);
 
+    /// Create a new process, that shares the memory of the current process copy-on-write,
+    /// and run the given runnable in its main thread.
+    /// Only page tables are copied, so data prepared by the current process (e.g. a parsed dataset)
+    /// is available to the new process without copying it. A page is only copied, once one of the processes writes to it.
+    /// The runnable must be allocated with `new`. It is deleted in the new process, which exits when the runnable returns.
+    /// Other threads and file descriptors of the current process are not cloned.
+    ///
+    /// ### Example
+    /// ```c++
+    /// class Worker : public Util::Async::Runnable {
+    /// public:
+    ///     explicit Worker(const Util::Array<uint32_t> &data) : data(data) {}
+    ///
+    ///     void run() override {
+    ///         // The worker sees the data of its parent, without it having been copied
+    ///         Util::System::out << "Data length: " << data.length() << Util::Io::PrintStream::lnFlush;
+    ///     }
+    ///
+    /// private:
+    ///     const Util::Array<uint32_t> &data;
+    /// };
+    ///
+    /// auto worker = Util::Async::Process::clone(new Worker(data), "/device/terminal", "/device/terminal", "/device/terminal");
+    /// worker.join();
+    /// ```
+    static Process clone(Runnable *runnable, const Io::File &inputFile, const Io::File &outputFile, const Io::File &errorFile);
+
     /// Get access to the current process.
     ///
     /// ### Example
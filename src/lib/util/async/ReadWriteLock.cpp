@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ReadWriteLock.h"
+
+#include "util/async/Thread.h"
+
+namespace Util {
+namespace Async {
+
+void ReadWriteLock::acquireRead() {
+    while (!tryAcquireRead()) {
+        // If neither a writer holds nor requests the lock, another reader has just changed the state -> retry.
+        const auto currentState = stateWrapper.get();
+        if (currentState == WRITE_LOCKED || writerWrapper.get() > 0) {
+            waitForChange(currentState);
+        }
+    }
+}
+
+bool ReadWriteLock::tryAcquireRead() {
+    const auto currentState = stateWrapper.get();
+    if (currentState == WRITE_LOCKED || writerWrapper.get() > 0) {
+        return false;
+    }
+
+    return stateWrapper.compareAndSet(currentState, currentState + 1);
+}
+
+void ReadWriteLock::releaseRead() {
+    const auto currentState = stateWrapper.get();
+    if (currentState == 0 || currentState == WRITE_LOCKED) {
+        return;
+    }
+
+    // Only the last reader needs to wake up waiting threads, since writers wait until no reader is left
+    // and readers only wait while a writer holds or requests the lock.
+    if (stateWrapper.fetchAndDec() == 1) {
+        wakeWaitingThreads();
+    }
+}
+
+void ReadWriteLock::acquireWrite() {
+    writerWrapper.inc();
+    while (!tryAcquireWrite()) {
+        const auto currentState = stateWrapper.get();
+        if (currentState != 0) {
+            waitForChange(currentState);
+        }
+    }
+
+    writerWrapper.dec();
+}
+
+bool ReadWriteLock::tryAcquireWrite() {
+    return stateWrapper.compareAndSet(0, WRITE_LOCKED);
+}
+
+void ReadWriteLock::releaseWrite() {
+    if (stateWrapper.compareAndSet(WRITE_LOCKED, 0)) {
+        wakeWaitingThreads();
+    }
+}
+
+bool ReadWriteLock::isWriteLocked() const {
+    return stateWrapper.get() == WRITE_LOCKED;
+}
+
+uint32_t ReadWriteLock::getReaderCount() const {
+    const auto currentState = stateWrapper.get();
+    return currentState == WRITE_LOCKED ? 0 : currentState;
+}
+
+void ReadWriteLock::waitForChange(uint32_t observedState) {
+    // The waiting counter is incremented before sleeping, so that a releasing thread either sees a waiting thread,
+    // or the state has already changed and `waitOnAddress()` returns immediately.
+    waitingWrapper.inc();
+    Thread::waitOnAddress(&state, observedState);
+    waitingWrapper.dec();
+}
+
+void ReadWriteLock::wakeWaitingThreads() {
+    if (waitingWrapper.get() > 0) {
+        Thread::wakeAddress(&state, UINT32_MAX);
+    }
+}
+
+}
+}
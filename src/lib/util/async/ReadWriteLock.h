@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LIB_UTIL_ASYNC_READWRITELOCK_H
+#define HHUOS_LIB_UTIL_ASYNC_READWRITELOCK_H
+
+#include <stdint.h>
+
+#include "util/async/Atomic.h"
+
+namespace Util {
+namespace Async {
+
+/// A reader-writer lock, that allows multiple readers or a single writer to hold the lock at the same time.
+/// It is intended for read-mostly data structures (e.g. mount tables), where readers should not block each other.
+/// Contending threads sleep via `Thread::waitOnAddress()`, so the lock must not be used in interrupt handlers.
+/// Writers are preferred: As soon as a writer is waiting, new readers have to wait until it has released the lock.
+/// The lock is not reentrant, so a thread holding the lock must not try to acquire it again (not even for reading).
+///
+/// ## Example
+///
+/// ```c++
+/// Util::HashMap<Util::String, int> map; // Global map, that is read often and changed rarely
+/// Util::Async::ReadWriteLock lock; // Lock to synchronize access to the map
+///
+/// // Multiple threads can look up values at the same time.
+/// int lookup(const Util::String &key) {
+///     lock.acquireRead();
+///     const auto value = map.get(key);
+///     lock.releaseRead();
+///
+///     return value;
+/// }
+///
+/// // Changing the map requires exclusive access.
+/// void insert(const Util::String &key, int value) {
+///     lock.acquireWrite();
+///     map.put(key, value);
+///     lock.releaseWrite();
+/// }
+/// ```
+class ReadWriteLock {
+
+public:
+    /// Create a new unlocked reader-writer lock.
+    ReadWriteLock() = default;
+
+    /// Locks should not be copied, since copies would not operate on the same value.
+    ReadWriteLock(const ReadWriteLock &copy) = delete;
+
+    /// Locks should not be copied, since copies would not operate on the same value.
+    ReadWriteLock& operator=(const ReadWriteLock &other) = delete;
+
+    /// Destructor.
+    ~ReadWriteLock() = default;
+
+    /// Acquire the lock for reading, blocking as long as a writer holds the lock or is waiting for it.
+    void acquireRead();
+
+    /// Try to acquire the lock for reading once.
+    /// If the lock is held or requested by a writer, the function does not block and returns false.
+    bool tryAcquireRead();
+
+    /// Release a read lock. If it was the last reader, waiting threads are woken up.
+    void releaseRead();
+
+    /// Acquire the lock for writing, blocking until no other thread holds the lock.
+    void acquireWrite();
+
+    /// Try to acquire the lock for writing once.
+    /// If the lock is held by any other thread, the function does not block and returns false.
+    bool tryAcquireWrite();
+
+    /// Release a write lock and wake up all waiting threads.
+    void releaseWrite();
+
+    /// Check if the lock is currently held by a writer.
+    bool isWriteLocked() const;
+
+    /// Get the number of threads currently holding the lock for reading.
+    uint32_t getReaderCount() const;
+
+    /// Release the read lock and return a given value (see `Util::Async::Lock::releaseAndReturn()`).
+    template<typename T>
+    T releaseReadAndReturn(T returnValue) {
+        releaseRead();
+        return returnValue;
+    }
+
+    /// Release the write lock and return a given value (see `Util::Async::Lock::releaseAndReturn()`).
+    template<typename T>
+    T releaseWriteAndReturn(T returnValue) {
+        releaseWrite();
+        return returnValue;
+    }
+
+private:
+
+    void waitForChange(uint32_t observedState);
+
+    void wakeWaitingThreads();
+
+    /// Number of readers holding the lock, or `WRITE_LOCKED` if a writer holds the lock.
+    uint32_t state = 0;
+    uint32_t waitingWriters = 0;
+    uint32_t waitingThreads = 0;
+    Atomic<uint32_t> stateWrapper = Atomic<uint32_t>(state);
+    Atomic<uint32_t> writerWrapper = Atomic<uint32_t>(waitingWriters);
+    Atomic<uint32_t> waitingWrapper = Atomic<uint32_t>(waitingThreads);
+
+    static constexpr uint32_t WRITE_LOCKED = UINT32_MAX;
+};
+
+}
+}
+
+#endif
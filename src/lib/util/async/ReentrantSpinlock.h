@@ -92,8 +92,8 @@ public:
             depth--;
         }
 
-        if (depth == 0) {
-            lockVarWrapper.compareAndSet(threadId, SPINLOCK_UNLOCK);
+        if (depth == 0 && lockVarWrapper.compareAndSet(threadId, SPINLOCK_UNLOCK)) {
+            wakeWaitingThread();
         }
     }
 
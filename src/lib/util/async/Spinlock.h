@@ -21,17 +21,22 @@
 #ifndef HHUOS_LIB_UTIL_ASYNC_SPINLOCK_H
 #define HHUOS_LIB_UTIL_ASYNC_SPINLOCK_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "util/async/Atomic.h"
 #include "util/async/Lock.h"
 #include "util/async/Thread.h"
+#include "interface.h"
 
 namespace Util {
 namespace Async {
 
 /// A simple spinlock implementation.
-/// It is implemented using Util::Async::Atomic on an 8-bit integer.
+/// It is implemented using Util::Async::Atomic on a 32-bit integer.
+/// In user space, a thread that fails to acquire the lock for a while is put to sleep via `Thread::waitOnAddress()`
+/// and woken up again, when the lock is released. In the kernel, waiting threads keep spinning,
+/// since kernel spinlocks also protect the scheduler and interrupt handlers.
 ///
 /// ## Example
 ///
@@ -62,10 +67,22 @@ public:
 
     /// Acquire the lock.
     /// This function calls `tryAcquire()` in a loop until the lock is acquired.
-    /// Every time `tryAcquire()` fails, `Thread::yield()` is called to allow other threads to run.
+    /// In the kernel, `Thread::yield()` is called every time `tryAcquire()` fails, to allow other threads to run.
+    /// In user space, the lock is retried a few times (its holder may be running on another CPU)
+    /// and afterward the thread sleeps until the lock is released.
     void acquire() final {
-        while (!tryAcquire()) {
-            Thread::yield();
+        if (!sleepingAllowed) {
+            while (!tryAcquire()) {
+                Thread::yield();
+            }
+
+            return;
+        }
+
+        for (size_t attempts = 1; !tryAcquire(); attempts++) {
+            if (attempts >= SPIN_ATTEMPTS) {
+                waitForRelease();
+            }
         }
     }
 
@@ -79,6 +96,7 @@ public:
     /// If the lock is not held, this function does nothing.
     void release() override {
         lockVarWrapper.set(SPINLOCK_UNLOCK);
+        wakeWaitingThread();
     }
 
     /// Check if the lock is currently held.
@@ -88,17 +106,43 @@ public:
 
 protected:
 
+    /// Wake up one thread, that is sleeping in `acquire()`. Must be called by subclasses after unlocking.
+    /// The system call is only issued if there actually are sleeping threads.
+    /// In the kernel, no thread ever sleeps in `acquire()`, so releasing a lock does not touch the waiting counter.
+    void wakeWaitingThread() {
+        if (sleepingAllowed && waitingWrapper.get() > 0) {
+            Thread::wakeAddress(&lockVar);
+        }
+    }
+
     /// Grant access to the lock variable for subclasses.
-    Atomic<uint16_t> lockVarWrapper = Atomic<uint16_t>(lockVar);
+    Atomic<uint32_t> lockVarWrapper = Atomic<uint32_t>(lockVar);
 
-    /// The unlocked state is represented by the value `UINT16_MAX`.
-    static constexpr uint16_t SPINLOCK_UNLOCK = UINT16_MAX;
+    /// The unlocked state is represented by the value `UINT32_MAX`.
+    static constexpr uint32_t SPINLOCK_UNLOCK = UINT32_MAX;
 
 private:
 
-    uint16_t lockVar = SPINLOCK_UNLOCK;
+    /// Sleep until the lock variable changes. The waiting counter is incremented before reading the lock variable,
+    /// so that `release()` either sees a waiting thread or the thread sees the lock being released.
+    void waitForRelease() {
+        waitingWrapper.inc();
+
+        const auto value = lockVarWrapper.get();
+        if (value != SPINLOCK_UNLOCK) {
+            Thread::waitOnAddress(&lockVar, value);
+        }
+
+        waitingWrapper.dec();
+    }
+
+    uint32_t lockVar = SPINLOCK_UNLOCK;
+    uint32_t waitingThreads = 0;
+    const bool sleepingAllowed = isLockSleepingAllowed(); // Fixed for the whole system, so it is only queried once per lock
+    Atomic<uint32_t> waitingWrapper = Atomic<uint32_t>(waitingThreads);
 
-    static constexpr uint16_t SPINLOCK_LOCK = 0x01;
+    static constexpr uint32_t SPINLOCK_LOCK = 0x01;
+    static constexpr size_t SPIN_ATTEMPTS = 100;
 };
 
 }
@@ -25,8 +25,8 @@
 namespace Util {
 namespace Async {
 
-Thread Thread::createThread(const String &name, Runnable *runnable) {
-    return ::createThread(name, runnable);
+Thread Thread::createThread(const String &name, Runnable *runnable, const uint32_t affinity) {
+    return ::createThread(name, runnable, affinity);
 }
 
 Thread Thread::getCurrentThread() {
@@ -41,9 +41,25 @@ void Thread::yield() {
     ::yield();
 }
 
+bool Thread::waitOnAddress(const volatile uint32_t *address, const uint32_t expectedValue) {
+    return ::waitOnAddress(address, expectedValue);
+}
+
+size_t Thread::wakeAddress(const volatile uint32_t *address, const size_t count) {
+    return ::wakeAddress(address, count);
+}
+
 void Thread::join() const {
     joinThread(id);
 }
 
+bool Thread::setNice(const int8_t nice) const {
+    return setThreadNice(id, nice);
+}
+
+bool Thread::setAffinity(const uint32_t affinity) const {
+    return setThreadAffinity(id, affinity);
+}
+
 }
 }
\ No newline at end of file
@@ -22,6 +22,7 @@
 #define HHUOS_LIB_UTIL_ASYNC_THREAD_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "util/async/Runnable.h"
 #include "util/base/String.h"
@@ -41,7 +42,8 @@ public:
 
     /// Start a new thread with the given name and runnable.
     /// The runnable must be heap allocated and will be deleted by the thread when it is done.
-    static Thread createThread(const String &name, Runnable *runnable);
+    /// The thread only runs on the CPUs contained in the given affinity mask (see `setAffinity()`).
+    static Thread createThread(const String &name, Runnable *runnable, uint32_t affinity = ALL_CPUS);
 
     /// Get access to the current thread.
     ///
@@ -68,6 +70,31 @@ public:
     /// ```
     static void yield();
 
+    /// Block the current thread, as long as the value at the given address equals the expected value,
+    /// until another thread calls `wakeAddress()` on the same address.
+    /// This is the building block for blocking synchronization primitives (similar to futexes in Linux).
+    /// Since spurious wakeups are possible, the value must always be checked again after this function returns.
+    /// Return true if the thread has been blocked, or false if the value did not match.
+    ///
+    /// ### Example
+    /// ```c++
+    /// uint32_t flag = 0; // Global variable, set to 1 by another thread
+    ///
+    /// // Wait until the flag is set, without wasting CPU time
+    /// while (flag == 0) {
+    ///     Util::Async::Thread::waitOnAddress(&flag, 0);
+    /// }
+    ///
+    /// // Code executed by the other thread
+    /// flag = 1;
+    /// Util::Async::Thread::wakeAddress(&flag);
+    /// ```
+    static bool waitOnAddress(const volatile uint32_t *address, uint32_t expectedValue);
+
+    /// Wake up to `count` threads, that are waiting on the given address via `waitOnAddress()`.
+    /// Return the number of threads that have been woken up.
+    static size_t wakeAddress(const volatile uint32_t *address, size_t count = 1);
+
     /// Join the thread by blocking until it has finished.
     ///
     /// ### Example
@@ -84,11 +111,45 @@ public:
     /// ```
     void join() const;
 
+    /// Set the nice value of the thread, which biases its scheduling priority.
+    /// The scheduler boosts threads that block often and decays threads that use up their time slices.
+    /// Negative nice values raise the priority of a thread, positive values lower it.
+    /// The value is clamped to the range [MIN_NICE, MAX_NICE].
+    /// Return true on success, or false if the thread does not exist anymore.
+    ///
+    /// ### Example
+    /// ```c++
+    /// auto thread = Util::Async::Thread::getCurrentThread();
+    /// thread.setNice(10); // Run as a background job
+    /// ```
+    bool setNice(int8_t nice) const;
+
+    /// Restrict the CPUs, the thread may run on. Bit n of the mask allows the CPU with the virtual ID n.
+    /// CPUs with an ID above 31 can only be used with `ALL_CPUS`.
+    /// A running thread is moved to an allowed CPU, the next time it is preempted or woken up.
+    /// Return false, if the thread does not exist anymore or if the mask contains no available CPU.
+    ///
+    /// ### Example
+    /// ```c++
+    /// auto thread = Util::Async::Thread::getCurrentThread();
+    /// thread.setAffinity(0x01); // Pin the thread to the bootstrap processor
+    /// ```
+    bool setAffinity(uint32_t affinity) const;
+
     /// Get the ID of the thread.
     size_t getId() const {
         return id;
     }
 
+    /// The lowest nice value (highest priority).
+    static constexpr int8_t MIN_NICE = -20;
+
+    /// The highest nice value (lowest priority).
+    static constexpr int8_t MAX_NICE = 19;
+
+    /// The affinity mask, that allows a thread to run on every CPU.
+    static constexpr uint32_t ALL_CPUS = UINT32_MAX;
+
 private:
 
     const size_t id;
@@ -56,14 +56,7 @@ void BitmapMemoryManager::freeBlock(void *pointer) {
 }
 
 size_t BitmapMemoryManager::getFreeMemory() const {
-    size_t freeMemory = 0;
-    for (size_t i = 0; i < bitmap.getSize(); i++) {
-        if (!bitmap.check(i)) {
-            freeMemory += blockSize;
-        }
-    }
-
-    return freeMemory;
+    return bitmap.getFreeBlocks() * blockSize;
 }
 
 void BitmapMemoryManager::markBlock(const void *pointer, const bool used) const {
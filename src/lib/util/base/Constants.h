@@ -37,6 +37,13 @@ static constexpr size_t USER_SPACE_MEMORY_START_ADDRESS = 0x20000000;
 /// The start address of the user space stack memory (0xf0000000 = 3.75 GiB).
 static constexpr size_t USER_SPACE_STACK_MEMORY_START_ADDRESS = 0xf0000000;
 
+/// The address of the time page, which the kernel maps read-only into every user space (see `Util::Time::TimePage`).
+/// It is located right below the user space stack memory, which is why the heap ends at this address.
+static constexpr size_t TIME_PAGE_ADDRESS = USER_SPACE_STACK_MEMORY_START_ADDRESS - 2 * PAGESIZE;
+
+/// The address of the page, to which the kernel maps the counter of the system timer, if it can be read from user space.
+static constexpr size_t TIME_COUNTER_PAGE_ADDRESS = TIME_PAGE_ADDRESS + PAGESIZE;
+
 /// The start address of each application's main stack.
 static constexpr size_t MAIN_STACK_START_ADDRESS = USER_SPACE_STACK_MEMORY_START_ADDRESS;
 
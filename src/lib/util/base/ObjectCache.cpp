@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ObjectCache.h"
+
+#include "interface.h"
+#include "util/async/Atomic.h"
+#include "util/async/Thread.h"
+#include "util/base/Address.h"
+#include "util/base/Constants.h"
+#include "util/base/Panic.h"
+
+namespace Util {
+
+/// General purpose caches, used by `allocateSized()`. They are constant-initialized,
+/// so they are ready even if a global constructor in another translation unit allocates a string.
+static ObjectCache sizeClassCaches[] = {
+    {16}, {32}, {64}, {128}, {256}
+};
+
+void* ObjectCache::allocate() {
+    acquireLock();
+
+    auto *slab = partialSlabs;
+    if (slab == nullptr) {
+        if (emptySlab != nullptr) {
+            slab = emptySlab;
+            emptySlab = nullptr;
+        } else {
+            slab = createSlab();
+        }
+
+        insert(partialSlabs, slab);
+    }
+
+    auto *object = slab->freeList;
+    slab->freeList = *static_cast<void**>(object);
+    slab->usedObjects++;
+
+    if (slab->usedObjects == slab->totalObjects) {
+        remove(partialSlabs, slab);
+        insert(fullSlabs, slab);
+    }
+
+    allocatedObjects++;
+    releaseLock();
+
+    return object;
+}
+
+void ObjectCache::free(void *object) {
+    if (object == nullptr) {
+        return;
+    }
+
+    acquireLock();
+
+    // Slabs are aligned to their size -> The header is found by rounding down
+    auto *slab = reinterpret_cast<Slab*>(Address(object).alignDown(slabSize).get());
+    if (slabSize == 0 || slab->cache != this) {
+        releaseLock();
+        Panic::fire(Panic::INVALID_ARGUMENT, "ObjectCache: Object does not belong to this cache!");
+    }
+
+    if (slab->usedObjects == slab->totalObjects) {
+        remove(fullSlabs, slab);
+        insert(partialSlabs, slab);
+    }
+
+    *static_cast<void**>(object) = slab->freeList;
+    slab->freeList = object;
+    slab->usedObjects--;
+    allocatedObjects--;
+
+    Slab *releasedSlab = nullptr;
+    if (slab->usedObjects == 0) {
+        remove(partialSlabs, slab);
+        if (emptySlab == nullptr) {
+            emptySlab = slab;
+        } else {
+            releasedSlab = slab;
+            slabCount--;
+        }
+    }
+
+    releaseLock();
+
+    if (releasedSlab != nullptr) {
+        freeMemory(releasedSlab, slabSize);
+    }
+}
+
+void* ObjectCache::allocateSized(const size_t size) {
+    if (size > MAX_SIZE_CLASS) {
+        return allocateMemory(size);
+    }
+
+    for (auto &cache : sizeClassCaches) {
+        if (size <= cache.getObjectSize()) {
+            return cache.allocate();
+        }
+    }
+
+    Panic::fire(Panic::ILLEGAL_STATE, "ObjectCache: No size class found!");
+}
+
+void ObjectCache::freeSized(void *pointer, const size_t size) {
+    if (size > MAX_SIZE_CLASS) {
+        freeMemory(pointer);
+        return;
+    }
+
+    for (auto &cache : sizeClassCaches) {
+        if (size <= cache.getObjectSize()) {
+            cache.free(pointer);
+            return;
+        }
+    }
+
+    Panic::fire(Panic::ILLEGAL_STATE, "ObjectCache: No size class found!");
+}
+
+size_t ObjectCache::getSlabSize() {
+    if (slabSize == 0) {
+        auto headerSize = alignUp(sizeof(Slab), alignment);
+        slabSize = PAGESIZE;
+        while ((slabSize - headerSize) / objectSize < MIN_OBJECTS_PER_SLAB) {
+            slabSize *= 2;
+        }
+    }
+
+    return slabSize;
+}
+
+ObjectCache::Slab* ObjectCache::createSlab() {
+    auto size = getSlabSize();
+    auto *slab = static_cast<Slab*>(allocateMemory(size, size));
+    auto headerSize = alignUp(sizeof(Slab), alignment);
+
+    slab->cache = this;
+    slab->previous = nullptr;
+    slab->next = nullptr;
+    slab->usedObjects = 0;
+    slab->totalObjects = (size - headerSize) / objectSize;
+
+    // Thread all objects into the free list, so that the lowest address is handed out first
+    auto *objects = reinterpret_cast<uint8_t*>(slab) + headerSize;
+    slab->freeList = objects;
+    for (size_t i = 0; i < slab->totalObjects; i++) {
+        auto *object = objects + i * objectSize;
+        *reinterpret_cast<void**>(object) = i + 1 < slab->totalObjects ? object + objectSize : nullptr;
+    }
+
+    slabCount++;
+    return slab;
+}
+
+void ObjectCache::insert(Slab *&list, Slab *slab) {
+    slab->previous = nullptr;
+    slab->next = list;
+    if (list != nullptr) {
+        list->previous = slab;
+    }
+
+    list = slab;
+}
+
+void ObjectCache::remove(Slab *&list, Slab *slab) {
+    if (slab->previous == nullptr) {
+        list = slab->next;
+    } else {
+        slab->previous->next = slab->next;
+    }
+
+    if (slab->next != nullptr) {
+        slab->next->previous = slab->previous;
+    }
+
+    slab->previous = nullptr;
+    slab->next = nullptr;
+}
+
+void ObjectCache::acquireLock() {
+    // A plain lock word is used instead of a Spinlock, so that the cache stays constant-initializable
+    Async::Atomic<uint32_t> lockWrapper(lock);
+    while (!lockWrapper.compareAndSet(0, 1)) {
+        Async::Thread::yield();
+    }
+}
+
+void ObjectCache::releaseLock() {
+    Async::Atomic<uint32_t> lockWrapper(lock);
+    lockWrapper.set(0);
+}
+
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LIB_UTIL_OBJECTCACHE_H
+#define HHUOS_LIB_UTIL_OBJECTCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Util {
+
+/// A slab-style cache for objects of a fixed size.
+/// Objects are carved out of slabs (page aligned chunks of heap memory), which are kept in a list of
+/// partially used slabs and a list of full slabs. Each slab has its own free list, so allocating and freeing
+/// an object takes constant time and never walks the general heap. One empty slab is kept for reuse,
+/// further empty slabs are given back to the heap.
+///
+/// The constructor is `constexpr` and the zero state of all members is valid,
+/// so caches with static storage duration can be used before global constructors have run.
+/// This class is thread-safe.
+///
+/// ### Example
+/// ```c++
+/// struct Vector { double x, y, z; };
+///
+/// static Util::ObjectCache vectorCache(sizeof(Vector), alignof(Vector));
+///
+/// auto *vector = new (vectorCache.allocate()) Vector{1, 2, 3};
+/// vector->~Vector();
+/// vectorCache.free(vector);
+/// ```
+class ObjectCache {
+
+public:
+    /// Create a new cache for objects of the given size and alignment.
+    /// No memory is allocated until the first object is requested.
+    constexpr ObjectCache(const size_t objectSize, const size_t alignment = sizeof(void*)) :
+        objectSize(alignUp(objectSize < sizeof(void*) ? sizeof(void*) : objectSize, alignment < sizeof(void*) ? sizeof(void*) : alignment)),
+        alignment(alignment < sizeof(void*) ? sizeof(void*) : alignment) {}
+
+    /// An object cache must not be copied, since the slabs point back to their cache.
+    ObjectCache(const ObjectCache &other) = delete;
+
+    /// An object cache must not be copied, since the slabs point back to their cache.
+    ObjectCache& operator=(const ObjectCache &other) = delete;
+
+    /// Allocate an object from the cache. The memory is not initialized.
+    /// If the heap is exhausted, a panic is fired.
+    void* allocate();
+
+    /// Give an object back to the cache. Nothing happens, if the pointer is nullptr.
+    /// If the object has not been allocated from this cache, a panic is fired.
+    void free(void *object);
+
+    /// Get the size of the objects in this cache (including padding for the alignment).
+    size_t getObjectSize() const {
+        return objectSize;
+    }
+
+    /// Get the amount of objects, that are currently allocated from this cache.
+    size_t getAllocatedObjectCount() const {
+        return allocatedObjects;
+    }
+
+    /// Get the amount of slabs, that currently belong to this cache (including the cached empty slab).
+    size_t getSlabCount() const {
+        return slabCount;
+    }
+
+    /// Allocate memory from one of the general purpose caches for sizes up to `MAX_SIZE_CLASS` bytes.
+    /// Larger requests are passed on to the heap. The memory must be freed with `freeSized()` and the same size.
+    ///
+    /// ### Example
+    /// ```c++
+    /// auto *buffer = static_cast<char*>(Util::ObjectCache::allocateSized(24)); // Served by the 32 byte cache
+    /// Util::ObjectCache::freeSized(buffer, 24);
+    /// ```
+    static void* allocateSized(size_t size);
+
+    /// Free memory, that has been allocated by `allocateSized()` with the same size.
+    static void freeSized(void *pointer, size_t size);
+
+    /// The largest size served by the general purpose caches.
+    static constexpr size_t MAX_SIZE_CLASS = 256;
+
+private:
+
+    /// Header at the start of every slab. The objects follow behind it.
+    struct Slab {
+        ObjectCache *cache;
+        Slab *previous;
+        Slab *next;
+        void *freeList;
+        size_t usedObjects;
+        size_t totalObjects;
+    };
+
+    static constexpr size_t alignUp(const size_t value, const size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    size_t getSlabSize();
+
+    Slab* createSlab();
+
+    static void insert(Slab *&list, Slab *slab);
+
+    static void remove(Slab *&list, Slab *slab);
+
+    void acquireLock();
+
+    void releaseLock();
+
+    const size_t objectSize;
+    const size_t alignment;
+    size_t slabSize = 0;
+
+    Slab *partialSlabs = nullptr;
+    Slab *fullSlabs = nullptr;
+    Slab *emptySlab = nullptr;
+
+    size_t allocatedObjects = 0;
+    size_t slabCount = 0;
+    uint32_t lock = 0;
+
+    /// Slabs are at least one page large and hold at least this many objects.
+    static constexpr size_t MIN_OBJECTS_PER_SLAB = 8;
+};
+
+}
+
+#endif
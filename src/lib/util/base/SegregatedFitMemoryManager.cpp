@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SegregatedFitMemoryManager.h"
+
+#include "util/base/operators.h"
+#include "util/base/Address.h"
+#include "util/base/Constants.h"
+#include "util/base/FreeListMemoryManager.h"
+#include "util/base/Panic.h"
+
+namespace Util {
+
+constexpr uint16_t SegregatedFitMemoryManager::SIZE_CLASSES[];
+
+SegregatedFitMemoryManager::SegregatedFitMemoryManager(FreeListMemoryManager &backingManager) : backingManager(backingManager) {
+    const auto startAddress = reinterpret_cast<uintptr_t>(backingManager.getStartAddress());
+    const auto endAddress = reinterpret_cast<uintptr_t>(backingManager.getEndAddress());
+
+    // The run table contains one byte per run sized window of the heap, holding the size class index plus one
+    runTableBase = startAddress - startAddress % RUN_SIZE;
+    runCount = (endAddress - runTableBase + RUN_SIZE - 1) / RUN_SIZE;
+    runTable = static_cast<uint8_t*>(backingManager.allocateMemory(runCount, 0));
+    Address(runTable).setRange(0, runCount);
+
+    threadCaches = static_cast<ThreadCache*>(backingManager.allocateMemory(sizeof(ThreadCache) * THREAD_CACHE_COUNT, alignof(ThreadCache)));
+    for (size_t i = 0; i < THREAD_CACHE_COUNT; i++) {
+        new (&threadCaches[i]) ThreadCache();
+    }
+}
+
+void* SegregatedFitMemoryManager::allocateMemory(const size_t size, const size_t alignment) {
+    if (size > MAX_SMALL_SIZE || alignment > MIN_ALIGNMENT) {
+        return backingManager.allocateMemory(size, alignment);
+    }
+
+    const auto sizeClass = getSizeClass(size);
+    auto &cache = getThreadCache();
+
+    cache.lock.acquire();
+
+    void *object = cache.freeLists[sizeClass];
+    if (object != nullptr) {
+        cache.freeLists[sizeClass] = cache.freeLists[sizeClass]->next;
+        cache.freeCounts[sizeClass]--;
+    } else {
+        object = refill(cache, sizeClass);
+    }
+
+    cache.lock.release();
+    return object;
+}
+
+void* SegregatedFitMemoryManager::reallocateMemory(void *pointer, const size_t size, const size_t alignment) {
+    const auto sizeClass = getRunSizeClass(pointer);
+    if (sizeClass < 0) {
+        return backingManager.reallocateMemory(pointer, size, alignment);
+    }
+
+    const size_t oldSize = SIZE_CLASSES[sizeClass];
+    if (size <= oldSize && alignment <= MIN_ALIGNMENT) {
+        return pointer;
+    }
+
+    // Keep the old block, if no new one is available (like realloc() does)
+    auto *newPointer = allocateMemory(size, alignment);
+    if (newPointer == nullptr) {
+        return nullptr;
+    }
+
+    Address(newPointer).copyRange(Address(pointer), size < oldSize ? size : oldSize);
+    freeMemory(pointer, alignment);
+
+    return newPointer;
+}
+
+void SegregatedFitMemoryManager::freeMemory(void *pointer, const size_t alignment) {
+    if (pointer == nullptr) {
+        return;
+    }
+
+    const auto sizeClass = getRunSizeClass(pointer);
+    if (sizeClass < 0) {
+        backingManager.freeMemory(pointer, alignment);
+        return;
+    }
+
+    auto &cache = getThreadCache();
+    auto *object = static_cast<FreeObject*>(pointer);
+
+    cache.lock.acquire();
+
+    object->next = cache.freeLists[sizeClass];
+    cache.freeLists[sizeClass] = object;
+
+    if (++cache.freeCounts[sizeClass] > MAX_CACHED_OBJECTS) {
+        flush(cache, sizeClass);
+    }
+
+    cache.lock.release();
+}
+
+size_t SegregatedFitMemoryManager::getTotalMemory() const {
+    return backingManager.getTotalMemory();
+}
+
+size_t SegregatedFitMemoryManager::getFreeMemory() const {
+    return backingManager.getFreeMemory();
+}
+
+void* SegregatedFitMemoryManager::getStartAddress() const {
+    return backingManager.getStartAddress();
+}
+
+void* SegregatedFitMemoryManager::getEndAddress() const {
+    return backingManager.getEndAddress();
+}
+
+bool SegregatedFitMemoryManager::isLocked() const {
+    return centralLock.isLocked() || backingManager.isLocked();
+}
+
+size_t SegregatedFitMemoryManager::getSizeClassSize(const size_t size) {
+    return size > MAX_SMALL_SIZE ? 0 : SIZE_CLASSES[getSizeClass(size)];
+}
+
+uint8_t SegregatedFitMemoryManager::getSizeClass(const size_t size) {
+    // Sizes up to 64 bytes are served in steps of 16 bytes
+    if (size <= 64) {
+        return size == 0 ? 0 : static_cast<uint8_t>((size - 1) / 16);
+    }
+
+    // Larger sizes are served by two classes per power of two (e.g. 96 and 128 bytes for sizes between 65 and 128)
+    const auto power = static_cast<uint32_t>(31 - __builtin_clz(size - 1));
+    const auto upperHalf = ((size - 1) >> (power - 1)) & 0x01;
+
+    return static_cast<uint8_t>(4 + (power - 6) * 2 + upperHalf);
+}
+
+SegregatedFitMemoryManager::ThreadCache& SegregatedFitMemoryManager::getThreadCache() const {
+    // Each thread runs on its own stack slot, so the stack address identifies the thread without a system call
+    const auto stackAddress = reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+    if (stackAddress < USER_SPACE_STACK_MEMORY_START_ADDRESS) {
+        return threadCaches[0];
+    }
+
+    const auto stackSlot = (stackAddress - USER_SPACE_STACK_MEMORY_START_ADDRESS) / MAX_USER_STACK_SIZE;
+    return threadCaches[stackSlot % THREAD_CACHE_COUNT];
+}
+
+int32_t SegregatedFitMemoryManager::getRunSizeClass(const void *pointer) const {
+    const auto address = reinterpret_cast<uintptr_t>(pointer);
+    if (address < runTableBase) {
+        return -1;
+    }
+
+    const auto index = (address - runTableBase) / RUN_SIZE;
+    if (index >= runCount) {
+        return -1;
+    }
+
+    return static_cast<int32_t>(runTable[index]) - 1;
+}
+
+void* SegregatedFitMemoryManager::refill(ThreadCache &cache, const uint8_t sizeClass) {
+    // Try to take a batch of objects from the central free list first
+    centralLock.acquire();
+    auto *object = centralFreeLists[sizeClass];
+    if (object != nullptr) {
+        auto *last = object;
+        size_t count = 1;
+        while (count < REFILL_BATCH_SIZE && last->next != nullptr) {
+            last = last->next;
+            count++;
+        }
+
+        centralFreeLists[sizeClass] = last->next;
+        centralLock.release();
+
+        // Keep all objects except the first one in the thread cache
+        last->next = nullptr;
+        cache.freeLists[sizeClass] = object->next;
+        cache.freeCounts[sizeClass] = count - 1;
+
+        return object;
+    }
+    centralLock.release();
+
+    // Carve the object out of the current run and start a new run, if the current one is exhausted
+    const auto objectSize = SIZE_CLASSES[sizeClass];
+    if (cache.runPointers[sizeClass] == nullptr || cache.runPointers[sizeClass] + objectSize > cache.runEnds[sizeClass]) {
+        auto *run = static_cast<uint8_t*>(backingManager.allocateMemory(RUN_SIZE, RUN_SIZE));
+        if (run == nullptr) {
+            // The backing heap is exhausted -> Report out of memory to the caller
+            return nullptr;
+        }
+
+        const auto index = (reinterpret_cast<uintptr_t>(run) - runTableBase) / RUN_SIZE;
+        if (index >= runCount) {
+            Panic::fire(Panic::ILLEGAL_STATE, "SegregatedFitMemoryManager: Run is outside of heap boundaries!");
+        }
+
+        runTable[index] = sizeClass + 1;
+        cache.runPointers[sizeClass] = run;
+        cache.runEnds[sizeClass] = run + RUN_SIZE;
+    }
+
+    auto *ret = cache.runPointers[sizeClass];
+    cache.runPointers[sizeClass] += objectSize;
+
+    return ret;
+}
+
+void SegregatedFitMemoryManager::flush(ThreadCache &cache, const uint8_t sizeClass) {
+    // Detach half of the cached objects and prepend them to the central free list
+    auto *first = cache.freeLists[sizeClass];
+    auto *last = first;
+    for (size_t i = 1; i < MAX_CACHED_OBJECTS / 2; i++) {
+        last = last->next;
+    }
+
+    cache.freeLists[sizeClass] = last->next;
+    cache.freeCounts[sizeClass] -= MAX_CACHED_OBJECTS / 2;
+
+    centralLock.acquire();
+    last->next = centralFreeLists[sizeClass];
+    centralFreeLists[sizeClass] = first;
+    centralLock.release();
+}
+
+}
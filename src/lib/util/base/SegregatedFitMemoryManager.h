@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LIB_UTIL_SEGREGATEDFITMEMORYMANAGER_H
+#define HHUOS_LIB_UTIL_SEGREGATEDFITMEMORYMANAGER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "util/async/Spinlock.h"
+#include "util/base/HeapMemoryManager.h"
+
+namespace Util {
+
+class FreeListMemoryManager;
+
+/// A heap memory manager that serves small allocations from segregated size classes.
+/// Objects up to `MAX_SMALL_SIZE` bytes are rounded up to one of `SIZE_CLASS_COUNT` size classes.
+/// Each size class is fed from runs (chunks of `RUN_SIZE` bytes, aligned to their size), which are taken from
+/// a backing `FreeListMemoryManager`. A run only holds objects of a single size class and is carved up
+/// using a bump pointer, so a fresh object does not need any bookkeeping besides a pointer increment.
+/// Freed objects are kept in per-thread caches, which are selected by the stack slot the calling thread
+/// runs on. This way, allocating and freeing memory usually only touches memory of the current thread
+/// and does not need a system call to identify it. If a thread cache grows too large, half of its objects for
+/// the affected size class are moved to a central free list, from which other threads can refill their caches.
+/// Allocations, that are larger than `MAX_SMALL_SIZE` or need a stricter alignment than `MIN_ALIGNMENT`,
+/// are passed to the backing memory manager. Runs are not given back to the backing memory manager.
+/// This class is thread-safe.
+///
+/// ### Example
+/// ```c++
+/// auto heap = Util::FreeListMemoryManager(startAddress, endAddress);
+/// auto manager = Util::SegregatedFitMemoryManager(heap);
+///
+/// auto *small = manager.allocateMemory(24, 0); // Served from the 32 byte size class
+/// auto *large = manager.allocateMemory(8192, 0); // Served by the free list memory manager
+///
+/// manager.freeMemory(small, 0);
+/// manager.freeMemory(large, 0);
+/// ```
+class SegregatedFitMemoryManager final : public HeapMemoryManager {
+
+public:
+    /// Create a new segregated fit memory manager on top of a given free list memory manager.
+    /// The lookup table for runs and the thread caches are allocated from the backing memory manager.
+    explicit SegregatedFitMemoryManager(FreeListMemoryManager &backingManager);
+
+    /// The memory manager hands out pointers into its runs, so it must not be copied.
+    SegregatedFitMemoryManager(const SegregatedFitMemoryManager &other) = delete;
+
+    /// The memory manager hands out pointers into its runs, so it must not be copied.
+    SegregatedFitMemoryManager &operator=(const SegregatedFitMemoryManager &other) = delete;
+
+    /// The runs are part of the backing heap, which is not affected by destroying this memory manager.
+    ~SegregatedFitMemoryManager() override = default;
+
+    /// Allocate a block of memory of a given size and alignment.
+    /// Small blocks are taken from the current thread's cache, a central free list or a run of their size class.
+    /// Large blocks are allocated by the backing memory manager.
+    void* allocateMemory(size_t size, size_t alignment) override;
+
+    /// Reallocate a previously allocated block of memory to a new size and alignment.
+    /// A small block is kept in place, if the new size still fits into its size class.
+    /// Large blocks are reallocated by the backing memory manager.
+    void* reallocateMemory(void *pointer, size_t size, size_t alignment) override;
+
+    /// Free a block of memory that was previously allocated by this memory manager or the backing memory manager.
+    /// Small blocks are put into the current thread's cache. If the pointer is nullptr, nothing happens.
+    void freeMemory(void *pointer, size_t alignment) override;
+
+    /// Get the total amount of memory managed by the backing memory manager.
+    size_t getTotalMemory() const override;
+
+    /// Get the amount of free memory left in the backing memory manager.
+    /// Memory held by runs counts as used, even if the objects inside the runs are free.
+    size_t getFreeMemory() const override;
+
+    /// Get the start address of the managed memory.
+    void* getStartAddress() const override;
+
+    /// Get the end address of the managed memory.
+    void* getEndAddress() const override;
+
+    /// Check if the central free lists or the backing memory manager are currently locked.
+    bool isLocked() const override;
+
+    /// Get the size of the size class, which serves allocations of the given size.
+    /// If the size exceeds `MAX_SMALL_SIZE`, 0 is returned.
+    static size_t getSizeClassSize(size_t size);
+
+    /// Objects up to this size are served from size classes, larger ones by the backing memory manager.
+    static constexpr size_t MAX_SMALL_SIZE = 2048;
+    /// Every object in a size class is aligned to at least this value.
+    static constexpr size_t MIN_ALIGNMENT = 16;
+    /// The size of a run, which holds the objects of a single size class.
+    static constexpr size_t RUN_SIZE = 64 * 1024;
+
+private:
+
+    /// A free object stores the pointer to the next free object of the same size class.
+    struct FreeObject {
+        FreeObject *next;
+    };
+
+    /// Number of size classes (16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048 bytes).
+    static constexpr uint8_t SIZE_CLASS_COUNT = 14;
+
+    /// A per-thread cache holding free objects and the current run of each size class.
+    /// The lock is only contended, if two threads with the same cache index allocate memory at the same time.
+    struct ThreadCache {
+        Async::Spinlock lock;
+        FreeObject *freeLists[SIZE_CLASS_COUNT] = {};
+        size_t freeCounts[SIZE_CLASS_COUNT] = {};
+        uint8_t *runPointers[SIZE_CLASS_COUNT] = {};
+        uint8_t *runEnds[SIZE_CLASS_COUNT] = {};
+    };
+
+    /// Get the index of the size class, which serves allocations of the given size (must be <= `MAX_SMALL_SIZE`).
+    static uint8_t getSizeClass(size_t size);
+
+    /// Get the thread cache of the calling thread, determined by the stack slot it runs on.
+    ThreadCache& getThreadCache() const;
+
+    /// Look up the size class of the run, that contains the given pointer.
+    /// If the pointer is not part of a run, -1 is returned.
+    int32_t getRunSizeClass(const void *pointer) const;
+
+    /// Allocate an object of the given size class, after the thread cache's free list has run empty.
+    /// Objects are first taken from the central free list and afterward from the thread cache's current run.
+    /// A new run is allocated from the backing memory manager if the current one is exhausted.
+    /// The thread cache's lock must be held.
+    void* refill(ThreadCache &cache, uint8_t sizeClass);
+
+    /// Move half of the cached objects of the given size class to the central free list.
+    /// The thread cache's lock must be held.
+    void flush(ThreadCache &cache, uint8_t sizeClass);
+
+    FreeListMemoryManager &backingManager;
+
+    uint8_t *runTable = nullptr;
+    uintptr_t runTableBase = 0;
+    size_t runCount = 0;
+
+    ThreadCache *threadCaches = nullptr;
+
+    Async::Spinlock centralLock;
+    FreeObject *centralFreeLists[SIZE_CLASS_COUNT] = {};
+
+    static constexpr uint16_t SIZE_CLASSES[SIZE_CLASS_COUNT] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048 };
+    static constexpr size_t THREAD_CACHE_COUNT = 16;
+    static constexpr size_t MAX_CACHED_OBJECTS = 256;
+    static constexpr size_t REFILL_BATCH_SIZE = 32;
+};
+
+}
+
+#endif
@@ -29,6 +29,7 @@
 
 #include "util/base/Address.h"
 #include "util/base/CharacterTypes.h"
+#include "util/base/ObjectCache.h"
 #include "util/collection/Array.h"
 #include "util/io/stream/OutputStream.h"
 #include "util/time/Date.h"
@@ -53,7 +54,7 @@ public:
     /// Create a new empty string, consisting only of the null terminator.
     String() {
         len = 0;
-        buffer = new char[1];
+        buffer = allocateBuffer(1);
 
         buffer[0] = '\0';
     }
@@ -61,7 +62,7 @@ public:
     /// Create a new string containing only the given character.
     String(char c) {
         len = 1;
-        buffer = new char[2];
+        buffer = allocateBuffer(2);
 
         buffer[0] = c;
         buffer[1] = '\0';
@@ -73,7 +74,7 @@ public:
         const auto address = Address(string);
 
         len = string == nullptr ? 0 : address.stringLength();
-        buffer = new char[len + 1];
+        buffer = allocateBuffer(len + 1);
 
         Address(buffer).copyRange(address, len);
         buffer[len] = '\0';
@@ -85,7 +86,7 @@ public:
         const auto address = Address(data);
 
         len = length;
-        buffer = new char[len + 1];
+        buffer = allocateBuffer(len + 1);
 
         Address(buffer).copyRange(address, len);
         buffer[len] = '\0';
@@ -94,7 +95,7 @@ public:
     /// Create a new string from an existing string (copy constructor).
     String(const String &other) {
         len = other.len;
-        buffer = new char[len + 1];
+        buffer = allocateBuffer(len + 1);
 
         Address(buffer).copyRange(Address(other.buffer), len);
         buffer[len] = '\0';
@@ -102,7 +103,7 @@ public:
 
     /// Delete the string and free the heap memory.
     ~String() {
-        delete[] buffer;
+        freeBuffer(buffer, len + 1);
     }
 
     /// Assign the given string to this string, overwriting the existing string.
@@ -119,9 +120,9 @@ public:
             return *this;
         }
 
-        delete[] buffer;
+        freeBuffer(buffer, len + 1);
         len = other.len;
-        buffer = new char[len + 1];
+        buffer = allocateBuffer(len + 1);
 
         Address(buffer).copyRange(Address(other.buffer), len + 1);
 
@@ -138,10 +139,20 @@ public:
     /// const auto string3 = string1 + string2; // string3 = "HelloWorld"
     /// ```
     String& operator+=(const String &other) {
-        buffer = static_cast<char*>(reallocateMemory(buffer, len + other.len + 1, 0));
-        Address(buffer + len).copyRange(Address(other.buffer), other.len + 1);
-        len += other.len;
+        if (len + 1 > ObjectCache::MAX_SIZE_CLASS) {
+            // Heap buffers can grow in place
+            buffer = static_cast<char*>(reallocateMemory(buffer, len + other.len + 1, 0));
+            Address(buffer + len).copyRange(Address(other.buffer), other.len + 1);
+        } else {
+            // Cached buffers have a fixed size -> Copy both parts before freeing the old buffer (other may be this string)
+            auto *newBuffer = allocateBuffer(len + other.len + 1);
+            Address(newBuffer).copyRange(Address(buffer), len);
+            Address(newBuffer + len).copyRange(Address(other.buffer), other.len + 1);
+            freeBuffer(buffer, len + 1);
+            buffer = newBuffer;
+        }
 
+        len += other.len;
         return *this;
     }
 
@@ -614,6 +625,16 @@ private:
     template<typename T>
     static T parseHexNumber(const char *string, size_t length);
 
+    /// Small buffers (which most strings use) come from the general purpose object caches instead of the heap.
+    /// The size of a buffer is always `len + 1`, so it can be derived when freeing it.
+    static char* allocateBuffer(const size_t size) {
+        return static_cast<char*>(ObjectCache::allocateSized(size));
+    }
+
+    static void freeBuffer(char *buffer, const size_t size) {
+        ObjectCache::freeSized(buffer, size);
+    }
+
     char *buffer;
     size_t len;
 
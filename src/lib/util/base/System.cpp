@@ -44,6 +44,27 @@ Io::BufferedOutputStream bufferedErrorStream(errorStream);
 Io::PrintStream System::error(bufferedErrorStream);
 
 void systemCall(System::Code code, bool &result, size_t paramCount, va_list args) {
+    // SYSEXIT always returns to ring 3, so code running in the kernel must use 'int 0x86'
+    uint16_t codeSegment;
+    asm volatile ("mov %%cs, %0" : "=r"(codeSegment));
+
+    if ((codeSegment & 0x03) == 0x03 && System::getAddressSpaceHeader().fastSystemCalls) {
+        // The kernel returns to the stack pointer in ecx and the instruction pointer in edx
+        size_t fastResult;
+        asm volatile (
+                "mov %%esp, %%ecx;"
+                "mov $1f, %%edx;"
+                "sysenter;"
+                "1:"
+                : "=a"(fastResult)
+                : "0"(code | (paramCount << 8)), "b"(args)
+                : "ecx", "edx", "memory"
+                );
+
+        result = fastResult != 0;
+        return;
+    }
+
     asm volatile (
             "int $0x86;"
             : "=m"(result)
@@ -26,6 +26,7 @@
 
 #include "util/base/BitmapMemoryManager.h"
 #include "util/base/FreeListMemoryManager.h"
+#include "util/base/SegregatedFitMemoryManager.h"
 #include "util/io/file/ElfFile.h"
 #include "lib/util/io/stream/InputStream.h" // IWYU pragma: keep
 #include "lib/util/io/stream/PrintStream.h" // IWYU pragma: keep
@@ -59,6 +60,7 @@ public:
         YIELD,
         EXIT_PROCESS,
         EXECUTE_BINARY,
+        CLONE_PROCESS,
         GET_CURRENT_PROCESS,
         GET_CURRENT_THREAD,
         JOIN_THREAD,
@@ -68,8 +70,14 @@ public:
         JOIN_PROCESS,
         KILL_PROCESS,
         SLEEP,
+        SET_THREAD_NICE,
+        WAIT_ON_ADDRESS,
+        WAKE_ADDRESS,
+        SET_THREAD_AFFINITY,
         UNMAP,
         MAP_IO,
+        MAP_FILE,
+        UNMAP_FILE,
         MOUNT,
         UNMOUNT,
         CREATE_FILE,
@@ -82,6 +90,9 @@ public:
         FILE_CHILDREN,
         WRITE_FILE,
         READ_FILE,
+        WRITE_FILE_VECTOR,
+        READ_FILE_VECTOR,
+        COPY_FILE_RANGE,
         CONTROL_FILE,
         CREATE_SOCKET,
         SEND_DATAGRAM,
@@ -90,6 +101,9 @@ public:
         GET_CURRENT_WORKING_DIRECTORY,
         CREATE_PIPE,
         CREATE_SHARED_MEMORY,
+        CREATE_IO_RING,
+        SUBMIT_IO_RING,
+        DESTROY_IO_RING,
         GET_SYSTEM_TIME,
         SET_DATE,
         GET_CURRENT_DATE,
@@ -97,12 +111,17 @@ public:
     };
 
     /// Every address space has this struct placed at `Util::USER_SPACE_MEMORY_START_ADDRESS`.
-    /// It contains the heap memory manager for this user space and a pointer the symbol table of the loaded program.
+    /// It contains the heap memory managers for this user space and a pointer the symbol table of the loaded program.
     struct AddressSpaceHeader {
-        /// The heap memory manager for this user space, which is used
-        /// when a program allocates memory using `new` and `delete`.
+        /// The heap memory manager for this user space, which manages the whole heap.
+        /// The kernel uses it directly, when it allocates memory inside a user space.
         /// It is initialized by the runtime library before the main function is called.
         FreeListMemoryManager heapMemoryManager;
+        /// The memory manager, which is used when a program allocates memory using `new` and `delete`.
+        /// It serves small objects from size classes with per-thread caches and passes
+        /// large allocations to `heapMemoryManager`, on top of which it is built.
+        /// It is initialized by the runtime library after `heapMemoryManager`.
+        SegregatedFitMemoryManager allocationMemoryManager;
         /// The stack memory manager for this user space, which is used when a program start a new thread.
         /// It is initialized by the runtime library before the main function is called.
         BitmapMemoryManager stackMemoryManager;
@@ -112,6 +131,10 @@ public:
         const Io::ElfFile::SymbolEntry *symbolTable;
         /// A pointer to the string table of the loaded program.
         const char *stringTable;
+        /// Set by the kernel, if system calls can be performed via SYSENTER/SYSEXIT instead of `int 0x86`.
+        /// SYSENTER avoids the interrupt descriptor table and is considerably faster on most CPUs.
+        /// A program may clear it to fall back to `int 0x86` (e.g. to compare both mechanisms).
+        bool fastSystemCalls;
     };
 
     /// Perform a system call.
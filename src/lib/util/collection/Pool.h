@@ -98,6 +98,19 @@ public:
     /// ```
     T* pop();
 
+    /// Remove an element from the pool and return it.
+    /// In contrast to `pop()`, nullptr is returned if the pool is empty.
+    ///
+    /// ### Example
+    /// ```c++
+    /// auto pool = Util::Pool<Util::Pair<int, int>>(1);
+    /// pool.push(new Util::Pair<int, int>(1, 2));
+    ///
+    /// auto *element = pool.tryPop(); // Returns the element added to the pool.
+    /// element = pool.tryPop(); // nullptr (pool is empty)
+    /// ```
+    T* tryPop();
+
     /// Get the capacity of the pool, i.e. the number of elements it can hold.
     ///
     /// ### Example
@@ -182,6 +195,19 @@ T* Pool<T>::pop() {
     return element;
 }
 
+template<typename T>
+T* Pool<T>::tryPop() {
+    size_t index = writtenMap.findAndUnset();
+    if (index == Async::AtomicBitmap::INVALID_INDEX) {
+        return nullptr;
+    }
+
+    T *element = array[index];
+    allocatedMap.unset(index);
+
+    return element;
+}
+
 template<typename T>
 size_t Pool<T>::getCapacity() const {
     return allocatedMap.getSize();
@@ -189,14 +215,7 @@ size_t Pool<T>::getCapacity() const {
 
 template<typename T>
 size_t Pool<T>::getObjectCount() const {
-    size_t objects = 0;
-    for (size_t i = 0; i < allocatedMap.getSize(); i++) {
-        if (allocatedMap.check(i)) {
-            objects++;
-        }
-    }
-
-    return objects;
+    return allocatedMap.getSize() - allocatedMap.getFreeBlocks();
 }
 
 template<typename T>
@@ -298,7 +298,8 @@ uint8_t* LinearFrameBuffer::mapBuffer(const uint32_t physicalAddress, const uint
     const auto sizeWithOffset = pageOffset + pitch * resolutionY;
     const auto pageCount = (sizeWithOffset + PAGESIZE - 1) / PAGESIZE;
 
-    auto *virtualAddress = mapIO(physicalAddress, pageCount);
+    // Frame buffers are written sequentially (e.g. when flushing a back buffer), which benefits from write-combining
+    auto *virtualAddress = mapIO(physicalAddress, pageCount, true);
     return static_cast<uint8_t*>(virtualAddress) + pageOffset;
 }
 
@@ -93,6 +93,43 @@ CpuInfo getCpuInfo() {
     return { family, model, stepping, static_cast<CpuType>(type), features };
 }
 
+XsaveInfo getXsaveInfo() {
+    if (!isAvailable() || (getCpuInfo().features & XSAVE) == 0) {
+        return {};
+    }
+
+    uint32_t maxLeaf;
+    asm volatile (
+    "mov $0,%%eax;"
+    "cpuid;"
+    : "=a"(maxLeaf)
+    :
+    : "%ebx", "%ecx", "%edx"
+    );
+
+    if (maxLeaf < 0x0d) {
+        return {};
+    }
+
+    uint32_t eax, ebx, ecx, edx;
+    asm volatile (
+    "cpuid;"
+    : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+    : "a"(0x0d), "c"(0)
+    );
+
+    uint32_t features = 0x0d;
+    uint32_t subLeaf = 1;
+    asm volatile (
+    "cpuid;"
+    : "+a"(features), "+c"(subLeaf)
+    :
+    : "%ebx", "%edx"
+    );
+
+    return { static_cast<uint64_t>(edx) << 32 | eax, ebx, ecx, (features & 0x01) != 0 };
+}
+
 Array<CpuFeature> CpuInfo::getFeaturesAsArray() const {
     if (!isAvailable()) {
         return Util::Array<CpuFeature>(0);
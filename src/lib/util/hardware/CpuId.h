@@ -105,6 +105,31 @@ enum CpuFeature : uint64_t {
     RDRAND = 1ull << 62
 };
 
+/// Enumeration of processor state components, that can be saved by XSAVE (bits in XCR0).
+enum XsaveComponent : uint64_t {
+    X87_STATE = 1ull << 0,
+    SSE_STATE = 1ull << 1,
+    AVX_STATE = 1ull << 2,
+    BNDREGS_STATE = 1ull << 3,
+    BNDCSR_STATE = 1ull << 4,
+    OPMASK_STATE = 1ull << 5,
+    ZMM_HI256_STATE = 1ull << 6,
+    HI16_ZMM_STATE = 1ull << 7
+};
+
+/// Structure to hold information about the XSAVE feature set, returned by the CPUID instruction with EAX = 0x0d.
+/// Call `getXsaveInfo()` to retrieve this information.
+struct XsaveInfo {
+    /// State components, that may be enabled in XCR0, as defined by the `XsaveComponent` enum.
+    uint64_t supportedComponents;
+    /// Size of the XSAVE area in bytes, needed for the components currently enabled in XCR0.
+    uint32_t enabledContextSize;
+    /// Size of the XSAVE area in bytes, needed for all supported components.
+    uint32_t maxContextSize;
+    /// True, if the XSAVEOPT instruction is supported.
+    bool xsaveopt;
+};
+
 /// Structure to hold CPU information returned by the CPUID instruction with EAX = 1.
 /// Call `getCpuInfo()` to retrieve this information.
 struct CpuInfo {
@@ -167,6 +192,19 @@ String getVendorString();
 /// ```
 CpuInfo getCpuInfo();
 
+/// Get information about the XSAVE feature set by executing the CPUID instruction with EAX = 0x0d.
+/// If XSAVE is not supported, all fields are zero.
+/// The size of the XSAVE area depends on the components enabled in XCR0, so it should be queried after enabling them.
+///
+/// ### Example
+/// ```c++
+/// const auto xsaveInfo = Util::Hardware::CpuId::getXsaveInfo();
+/// if (xsaveInfo.supportedComponents & Util::Hardware::CpuId::AVX_STATE) {
+///     Util::System::out << "AVX state can be saved in " << xsaveInfo.maxContextSize << " bytes" << Util::Io::PrintStream::lnFlush;
+/// }
+/// ```
+XsaveInfo getXsaveInfo();
+
 /// Get a string representation of the specified CPU feature.
 const char *getFeatureAsString(CpuFeature feature);
 
@@ -97,6 +97,18 @@ public:
         END
     };
 
+    /// Describes one segment of a vectored read or write (see `readFileVector()` and `writeFileVector()`).
+    /// Each segment has its own buffer and file position, so scattered regions of a file
+    /// can be transferred into or from multiple buffers with a single system call.
+    struct IoVector {
+        /// The buffer to read into or write from. It must hold at least `length` bytes.
+        void *buffer;
+        /// The position in the file at which the transfer of this segment starts.
+        uint64_t position;
+        /// The number of bytes to transfer for this segment.
+        uint64_t length;
+    };
+
     /// Create a new file instance without a path (always referring to the root directory "/").
     /// This is mostly useless and just provided, so that data structures like arrays can be created of files.
     ///
@@ -20,6 +20,7 @@
 
 #include "TarArchive.h"
 
+#include "interface.h"
 #include "util/base/Address.h"
 #include "util/collection/ArrayList.h"
 #include "util/io/stream/FileInputStream.h"
@@ -31,9 +32,17 @@ TarArchive::TarArchive(uint8_t *buffer) : deleteArchiveBuffer(false), archiveBuf
     parseArchive();
 }
 
-TarArchive::TarArchive(const File &file) : deleteArchiveBuffer(true), archiveBuffer(new uint8_t[file.getLength()]) {
-    FileInputStream inputStream(file);
-    inputStream.read(archiveBuffer, 0, file.getLength());
+TarArchive::TarArchive(const File &file) : deleteArchiveBuffer(false),
+    archiveBuffer(static_cast<uint8_t*>(mapFile(file.getCanonicalPath(), 0, 0))) {
+    if (archiveBuffer != nullptr) {
+        unmapArchiveBuffer = true;
+    } else {
+        deleteArchiveBuffer = true;
+        archiveBuffer = new uint8_t[file.getLength()];
+
+        FileInputStream inputStream(file);
+        inputStream.read(archiveBuffer, 0, file.getLength());
+    }
 
     parseArchive();
 }
@@ -41,6 +50,8 @@ TarArchive::TarArchive(const File &file) : deleteArchiveBuffer(true), archiveBuf
 TarArchive::~TarArchive() {
     if (deleteArchiveBuffer) {
         delete[] archiveBuffer;
+    } else if (unmapArchiveBuffer) {
+        unmapFile(archiveBuffer);
     }
 }
 
@@ -101,7 +101,9 @@ public:
 
     /// Create a tar archive instance from a File object.
     /// The file must contain a valid uncompressed tar archive.
-    /// The whole file is read into memory for parsing.
+    /// The file is mapped into memory via `mapFile()`, so only the pages containing the headers
+    /// and the data of accessed files are actually read. If the file cannot be mapped,
+    /// the whole file is read into memory instead.
     explicit TarArchive(const File &file);
 
     /// TarArchive is not copyable, since it manages a memory buffer.
@@ -142,6 +144,7 @@ private:
     static size_t parseNumber(const char *string, size_t length);
 
     bool deleteArchiveBuffer;
+    bool unmapArchiveBuffer = false;
     uint8_t *archiveBuffer;
     Array<const Header*> headers;
 };
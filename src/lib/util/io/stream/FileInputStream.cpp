@@ -88,6 +88,48 @@ int32_t FileInputStream::read(uint8_t *targetBuffer, const size_t offset, const
     return static_cast<int32_t>(read + peeked);
 }
 
+int32_t FileInputStream::readVector(File::IoVector *vectors, const size_t count) {
+    if (peekedChar >= 0) {
+        if (fileType != File::REGULAR) {
+            // The peeked byte cannot be read again from a stream -> Fill the vectors one by one
+            int32_t total = 0;
+            for (size_t i = 0; i < count; i++) {
+                const auto bytes = read(static_cast<uint8_t*>(vectors[i].buffer), 0, vectors[i].length);
+                if (bytes <= 0) {
+                    return total > 0 ? total : bytes;
+                }
+
+                total += bytes;
+                if (static_cast<uint64_t>(bytes) < vectors[i].length) {
+                    break;
+                }
+            }
+
+            return total;
+        }
+
+        // Regular files can simply be read again from the peeked position
+        pos--;
+        peekedChar = -1;
+    }
+
+    auto position = pos;
+    for (size_t i = 0; i < count; i++) {
+        vectors[i].position = position;
+        position += vectors[i].length;
+    }
+
+    const auto read = readFileVector(fileDescriptor, vectors, count);
+    pos += read;
+
+    if (read == 0 && fileType == File::REGULAR) {
+        // No byte has been read from a regular file -> End of file reached
+        return -1;
+    }
+
+    return static_cast<int32_t>(read);
+}
+
 int16_t FileInputStream::peek() {
     if (peekedChar >= 0) {
         // A previous peek operation has already read a byte -> Return it instead of reading a new one
@@ -111,6 +111,23 @@ public:
 	/// but there is currently no data available to read.
 	int32_t read(uint8_t *targetBuffer, size_t offset, size_t length) override;
 
+	/// Read consecutive bytes from the current position into multiple buffers with a single system call.
+	/// The buffer and length of each vector must be set by the caller, while the file positions are
+	/// filled in by this method, so that the vectors cover the file contiguously from the current position.
+	/// The vectors are filled in order and reading stops at the first vector that could not be filled completely.
+	/// The total number of bytes read is returned, or -1 if the end of the file is reached before reading any bytes.
+	/// This is useful for reading several differently typed headers at once, without buffering the stream.
+	///
+	/// ### Example
+	/// ```c++
+	/// Header header;
+	/// uint8_t payload[64];
+	/// Util::Io::File::IoVector vectors[2] = {{&header, 0, sizeof(Header)}, {payload, 0, sizeof(payload)}};
+	///
+	/// const auto read = fileStream.readVector(vectors, 2);
+	/// ```
+	int32_t readVector(File::IoVector *vectors, size_t count);
+
 	/// Check if there is data available to read from the file.
 	/// If this method returns true, a subsequent read call is guaranteed to succeed without blocking.
 	bool isReadyToRead() override;
@@ -20,6 +20,7 @@
 
 #include "PipedInputStream.h"
 
+#include "util/async/Atomic.h"
 #include "util/async/Thread.h"
 #include "util/base/Address.h"
 #include "util/base/Panic.h"
@@ -60,12 +61,11 @@ int32_t PipedInputStream::read(uint8_t *targetBuffer, size_t offset, size_t leng
         return 0;
     }
 
-    // Block while buffer is empty
+    // Block while buffer is empty (notify first, so that threads on both sides never sleep at the same time)
     lock.acquire();
     while (inPosition < 0) {
-        lock.release();
-        Async::Thread::yield();
-        lock.acquire();
+        notifyChange();
+        waitForChange();
     }
 
     size_t targetOffset = offset;
@@ -103,6 +103,7 @@ int32_t PipedInputStream::read(uint8_t *targetBuffer, size_t offset, size_t leng
 
         // Check if we have copied the requested amount of bytes or if the internal buffer is empty
         if (remaining == 0 || inPosition == -1) {
+            notifyChange();
             lock.release();
             return static_cast<int32_t>(readBytes);
         }
@@ -114,12 +115,11 @@ int16_t PipedInputStream::peek() {
         Panic::fire(Panic::ILLEGAL_STATE, "PipedOutputStream: Not connected to a source!");
     }
 
-    // Block while buffer is empty
+    // Block while buffer is empty (notify first, so that threads on both sides never sleep at the same time)
     lock.acquire();
     while (inPosition < 0) {
-        lock.release();
-        Async::Thread::yield();
-        lock.acquire();
+        notifyChange();
+        waitForChange();
     }
 
     return outPosition < inPosition ? buffer[outPosition] : buffer[(outPosition + 1) % bufferSize];
@@ -135,11 +135,10 @@ size_t PipedInputStream::write(const uint8_t *sourceBuffer, const size_t offset,
     lock.acquire();
 
     while (remaining > 0) {
-        // Block while buffer is full
+        // Block while buffer is full (readers, that are waiting for the bytes written so far, must be woken up first)
         while (inPosition == outPosition) {
-            lock.release();
-            Async::Thread::yield();
-            lock.acquire();
+            notifyChange();
+            waitForChange();
         }
 
         if (inPosition < 0) { // Buffer is empty
@@ -169,8 +168,29 @@ size_t PipedInputStream::write(const uint8_t *sourceBuffer, const size_t offset,
         }
     }
 
+    notifyChange();
     return lock.releaseAndReturn(length);
 }
 
+void PipedInputStream::waitForChange() {
+    // Register as waiting thread before releasing the lock, so that the next change is guaranteed to wake us up
+    Async::Atomic<uint32_t> waitingWrapper(waitingThreads);
+    const auto observedChanges = changeCount;
+    waitingWrapper.inc();
+    lock.release();
+
+    Async::Thread::waitOnAddress(&changeCount, observedChanges);
+
+    waitingWrapper.dec();
+    lock.acquire();
+}
+
+void PipedInputStream::notifyChange() {
+    changeCount++;
+    if (waitingThreads > 0) {
+        Async::Thread::wakeAddress(&changeCount, SIZE_MAX);
+    }
+}
+
 }
 }
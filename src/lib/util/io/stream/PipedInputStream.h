@@ -149,6 +149,13 @@ private:
 		return bufferSize - getReadableBytes();
 	}
 
+	/// Sleep until another thread has read from or written to the buffer.
+	/// The lock must be held by the caller. It is released while sleeping and acquired again before returning.
+	void waitForChange();
+
+	/// Wake up all threads waiting in `waitForChange()`. The lock must be held by the caller.
+	void notifyChange();
+
 	PipedOutputStream *source = nullptr;
 
 	Async::Spinlock lock;
@@ -159,6 +166,9 @@ private:
 	int32_t inPosition = -1;
 	int32_t outPosition = 0;
 
+	uint32_t changeCount = 0; // Incremented on every read and write, used as address to wait on
+	uint32_t waitingThreads = 0;
+
 	static constexpr size_t DEFAULT_BUFFER_SIZE = 1024;
 
 };
@@ -26,6 +26,7 @@
 
 #include <stdint.h>
 
+#include "util/base/ObjectCache.h"
 #include "util/network/Datagram.h"
 #include "util/network/ip4/Ip4PortAddress.h"
 
@@ -96,6 +97,23 @@ public:
     /// Since this class has no specific attributes, this method does nothing.
     /// It is provided to fulfill the interface contract of the Datagram class.
     void setAttributes(const Datagram&) override {}
+
+    /// The kernel creates a datagram for every received UDP packet, so datagrams are allocated from an object cache.
+    static void* operator new(size_t) {
+        return getCache().allocate();
+    }
+
+    /// Give a datagram's memory back to the object cache.
+    static void operator delete(void *pointer) {
+        getCache().free(pointer);
+    }
+
+private:
+
+    static ObjectCache& getCache() {
+        static ObjectCache cache(sizeof(UdpDatagram), alignof(UdpDatagram));
+        return cache;
+    }
 };
 
 }
@@ -26,13 +26,16 @@ namespace Util {
 namespace Sound {
 
 WaveFile::WaveFile(const Io::File &file) : FilterInputStream(stream), stream(file) {
-    // Read the RIFF and format chunks from the beginning of the file.
-    FilterInputStream::read(reinterpret_cast<uint8_t*>(&riffChunk), 0, sizeof(RiffChunk));
-    FilterInputStream::read(reinterpret_cast<uint8_t*>(&formatChunk), 0, sizeof(FormatChunk));
+    // Read the RIFF and format chunks, as well as the header of the following chunk, with a single system call.
+    Io::File::IoVector vectors[3] = {
+        {&riffChunk, 0, sizeof(RiffChunk)},
+        {&formatChunk, 0, sizeof(FormatChunk)},
+        {&dataChunk, 0, sizeof(DataChunk)}
+    };
+    auto read = stream.readVector(vectors, 3);
 
     // Search for the 'data' chunk in the file, by reading chunks until we find one with the 'data' signature.
     // Afterward, this stream will be positioned at the start of the 'data' chunk and is ready for reading audio data.
-    auto read = FilterInputStream::read(reinterpret_cast<uint8_t*>(&dataChunk), 0, sizeof(dataChunk));
     while (dataChunk.dataSignature[0] != 'd' &&dataChunk.dataSignature[1] != 'a' &&
         dataChunk.dataSignature[2] != 't' && dataChunk.dataSignature[3] != 'a')
     {
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2017-2026 Heinrich Heine University Düsseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Main developers: Christian Gesse <christian.gesse@hhu.de>, Fabian Ruhland <ruhland@hhu.de>
+ * Original development team: Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schöttner
+ * This project has been supported by several students.
+ * A full list of integrated student theses can be found here: https://github.com/hhuOS/hhuOS/wiki/Student-theses
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LIB_UTIL_TIME_TIMEPAGE_H
+#define HHUOS_LIB_UTIL_TIME_TIMEPAGE_H
+
+#include <stdint.h>
+
+namespace Util {
+namespace Time {
+
+/// The kernel maps this struct read-only into every user space at `Util::TIME_PAGE_ADDRESS`.
+/// It contains the system time and the current date, as published by the kernel's time service,
+/// allowing user space to query them without performing a system call.
+/// The kernel increments `sequence` before and after each update, so it is odd while an update is in progress.
+/// Readers must copy the fields they need and retry, if the sequence was odd or has changed meanwhile.
+struct TimePage {
+    /// Bits for `flags`, indicating which parts of the page have been published.
+    enum Flags : uint32_t {
+        /// `systemTime` is valid. If `femtosecondsPerTick` is not 0, the system time is interpolated via the counter.
+        SYSTEM_TIME_VALID = 1 << 0,
+        /// `unixTime` is valid.
+        DATE_VALID = 1 << 1
+    };
+
+    /// The sequence counter, which is incremented by the kernel before and after each update.
+    volatile uint32_t sequence;
+    /// A combination of `Flags`.
+    uint32_t flags;
+    /// The number of updates of the system time.
+    uint32_t tickCount;
+    /// The user space address of the system timer's free running counter (mapped to `Util::TIME_COUNTER_PAGE_ADDRESS`),
+    /// which is read as two 32-bit words (low, high). Only valid if `femtosecondsPerTick` is not 0.
+    uint32_t counterAddress;
+    /// The system time in nanoseconds at the last update.
+    uint64_t systemTime;
+    /// The counter value at the last update.
+    uint64_t counterValue;
+    /// The highest value of the counter, after which it wraps around.
+    uint64_t counterMaxValue;
+    /// The length of a counter tick in femtoseconds, or 0 if there is no counter readable from user space.
+    /// In this case, the resolution of the system time is limited to the interval of the system timer.
+    uint64_t femtosecondsPerTick;
+    /// The current date as unix time (seconds since 1. January 1970).
+    int64_t unixTime;
+};
+
+}
+}
+
+#endif